@@ -0,0 +1,13 @@
+﻿#pragma once
+#include <benchmark/benchmark.h>
+
+//------------------------------
+// 벤치마크 공통 설정
+//------------------------------
+
+// 경합 케이스는 1 ~ MAX_CONTENDED_THREADS 스레드까지 2배씩 증가시키며 측정
+constexpr int MAX_CONTENDED_THREADS = 8;
+
+// 경합 케이스 등록: 스레드 수 증가 + 실제 경과 시간 기준 (CPU 시간은 대기 구간을 숨김)
+#define BENCHMARK_CONTENDED(func) \
+	BENCHMARK(func)->ThreadRange(1, MAX_CONTENDED_THREADS)->UseRealTime()
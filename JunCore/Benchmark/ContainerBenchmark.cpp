@@ -0,0 +1,224 @@
+﻿#include "BenchmarkCommon.h"
+#include "../JunCommon/container/LFQueue.h"
+#include "../JunCommon/container/LFSlotMap.h"
+#include "../JunCommon/container/LFStack.h"
+#include "../JunCommon/container/MPSCQueue.h"
+#include "../JunCommon/container/RingBuffer.h"
+#include <mutex>
+#include <queue>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+//------------------------------
+// LFQueue / LFStack / RingBuffer
+// 경합 케이스는 모든 스레드가 같은 컨테이너에 넣고/빼기를 반복 (크기는 스레드 수 이내로 유지)
+//------------------------------
+
+static void BM_LFQueue_EnqueueDequeue(benchmark::State& state)
+{
+	static LFQueue<uint64_t> queue;
+
+	uint64_t value = 0;
+	for (auto _ : state)
+	{
+		queue.Enqueue(value++);
+		benchmark::DoNotOptimize(queue.Dequeue(&value));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CONTENDED(BM_LFQueue_EnqueueDequeue);
+
+// 비교 기준: std::mutex + std::queue
+static void BM_MutexQueue_EnqueueDequeue(benchmark::State& state)
+{
+	static std::mutex lock;
+	static std::queue<uint64_t> queue;
+
+	uint64_t value = 0;
+	for (auto _ : state)
+	{
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			queue.push(value++);
+		}
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			if (!queue.empty())
+			{
+				value = queue.front();
+				queue.pop();
+			}
+		}
+		benchmark::DoNotOptimize(value);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CONTENDED(BM_MutexQueue_EnqueueDequeue);
+
+// 배치 단위 적재 후 일괄 소비 (JobObject 큐 사용 패턴)
+static void BM_LFQueue_Batch(benchmark::State& state)
+{
+	LFQueue<uint64_t> queue;
+	const int64_t batch = state.range(0);
+
+	uint64_t value = 0;
+	for (auto _ : state)
+	{
+		for (int64_t i = 0; i < batch; i++)
+		{
+			queue.Enqueue(i);
+		}
+		while (queue.Dequeue(&value))
+		{
+			benchmark::DoNotOptimize(value);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_LFQueue_Batch)->Arg(1)->Arg(16)->Arg(256);
+
+// 같은 패턴을 침습형 MPSCQueue로 (현재 JobObject 큐, 노드는 미리 확보)
+struct BenchQueueNode : MPSCQueueNode
+{
+	uint64_t value;
+};
+
+static void BM_MPSCQueue_Batch(benchmark::State& state)
+{
+	MPSCQueue<BenchQueueNode> queue;
+	const int64_t batch = state.range(0);
+	std::vector<BenchQueueNode> nodes(batch);
+
+	for (auto _ : state)
+	{
+		for (int64_t i = 0; i < batch; i++)
+		{
+			nodes[i].value = i;
+			queue.Enqueue(&nodes[i]);
+		}
+		while (BenchQueueNode* node = queue.Dequeue())
+		{
+			benchmark::DoNotOptimize(node->value);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_MPSCQueue_Batch)->Arg(1)->Arg(16)->Arg(256);
+
+static void BM_LFStack_PushPop(benchmark::State& state)
+{
+	static LFStack<uint64_t> stack;
+
+	uint64_t value = 0;
+	for (auto _ : state)
+	{
+		stack.Push(value++);
+		benchmark::DoNotOptimize(stack.Pop(&value));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CONTENDED(BM_LFStack_PushPop);
+
+// GameObjectManager::PostTo 조회 패턴: 모든 스레드가 같은 맵에서 임의 핸들 조회
+namespace
+{
+	constexpr int SLOT_MAP_OBJECTS = 4096;
+
+	struct SlotMapFixture
+	{
+		LFSlotMap<uint64_t> map;
+		std::vector<uint64_t> values;
+		std::vector<uint64_t> handles;
+
+		SlotMapFixture() : values(SLOT_MAP_OBJECTS)
+		{
+			for (int i = 0; i < SLOT_MAP_OBJECTS; i++)
+			{
+				handles.push_back(map.Allocate());
+				map.Publish(handles.back(), &values[i]);
+			}
+		}
+	};
+}
+
+static void BM_LFSlotMap_Visit(benchmark::State& state)
+{
+	static SlotMapFixture fixture;
+
+	uint32_t index = static_cast<uint32_t>(state.thread_index()) * 977;
+	uint64_t sum = 0;
+	for (auto _ : state)
+	{
+		index = (index + 1) & (SLOT_MAP_OBJECTS - 1);
+		fixture.map.Visit(fixture.handles[index], [&sum](uint64_t* value) { sum += *value; });
+	}
+	benchmark::DoNotOptimize(sum);
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CONTENDED(BM_LFSlotMap_Visit);
+
+// 비교 기준: std::shared_mutex + std::unordered_map
+static void BM_SharedMutexMap_Find(benchmark::State& state)
+{
+	static std::shared_mutex lock;
+	static std::unordered_map<uint64_t, uint64_t> map = []()
+	{
+		std::unordered_map<uint64_t, uint64_t> objects;
+		for (uint64_t i = 0; i < SLOT_MAP_OBJECTS; i++)
+		{
+			objects.emplace(i, i);
+		}
+		return objects;
+	}();
+
+	uint64_t key = static_cast<uint64_t>(state.thread_index()) * 977;
+	uint64_t sum = 0;
+	for (auto _ : state)
+	{
+		key = (key + 1) & (SLOT_MAP_OBJECTS - 1);
+		std::shared_lock<std::shared_mutex> guard(lock);
+		auto it = map.find(key);
+		if (it != map.end())
+		{
+			sum += it->second;
+		}
+	}
+	benchmark::DoNotOptimize(sum);
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CONTENDED(BM_SharedMutexMap_Find);
+
+// 세션 송수신 버퍼 패턴: size 바이트 Enqueue 후 Dequeue (랩어라운드 포함)
+static void BM_RingBuffer_EnqueueDequeue(benchmark::State& state)
+{
+	RingBuffer ring;
+	const size_t size = static_cast<size_t>(state.range(0));
+	std::vector<char> src(size, 'x');
+	std::vector<char> dst(size);
+
+	for (auto _ : state)
+	{
+		ring.Enqueue(src.data(), size);
+		ring.Dequeue(dst.data(), size);
+		benchmark::DoNotOptimize(dst.data());
+	}
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+BENCHMARK(BM_RingBuffer_EnqueueDequeue)->RangeMultiplier(4)->Range(8, 4096);
+
+static void BM_RingBuffer_Peek(benchmark::State& state)
+{
+	RingBuffer ring;
+	const size_t size = static_cast<size_t>(state.range(0));
+	std::vector<char> src(size, 'x');
+	std::vector<char> dst(size);
+	ring.Enqueue(src.data(), size);
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(ring.Peek(dst.data(), size));
+	}
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+BENCHMARK(BM_RingBuffer_Peek)->Arg(8)->Arg(64)->Arg(512);
@@ -0,0 +1,436 @@
+﻿#include "BenchmarkCommon.h"
+#include "../JunCore/core/Event.h"
+#include "../JunCore/logic/Job.h"
+#include "../JunCore/logic/AoiGrid.h"
+#include "../JunCore/logic/Entity.h"
+#include "../JunCore/logic/GameObject.h"
+#include "../JunCore/logic/GameScene.h"
+#include "../JunCore/logic/GameThread.h"
+#include "../JunCore/logic/JobObject.h"
+#include "../JunCore/logic/JobTask.h"
+#include "../JunCore/logic/JobThread.h"
+#include "../JunCore/logic/JobThreadPool.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+//------------------------------
+// AoiGrid / Event / Entity / JobObject
+// 스레드는 시작하지 않고 큐를 직접 비워서 로직 비용만 측정
+//------------------------------
+
+namespace
+{
+	constexpr float MAP_MIN = -400.f;
+	constexpr float MAP_MAX = 400.f;
+	constexpr float CELL_LEN = 20.f;
+	constexpr float HYSTERESIS_BUFFER = 2.f;
+	constexpr float MOVE_STEP = 1.f;		// 틱당 이동량 (셀 경계 통과는 일부 틱에서만 발생)
+
+	// 생성자가 protected인 GameObject를 벤치마크에서 직접 생성하기 위한 래퍼
+	class BenchObject : public GameObject
+	{
+	public:
+		BenchObject(GameScene* scene, float x, float z)
+			: GameObject(scene, x, 0.f, z)
+		{
+		}
+
+		void OnAppear(std::vector<GameObject*>& others) override { appearCount += others.size(); }
+		void OnDisappear(std::vector<GameObject*>& others) override { disappearCount += others.size(); }
+
+		size_t appearCount = 0;
+		size_t disappearCount = 0;
+	};
+
+	// ProcessJobObjects를 호출 스레드에서 직접 실행
+	class BenchJobThread : public JobThread
+	{
+	public:
+		void Drain() { ProcessJobObjects(); }
+	};
+
+	template<int N>
+	class BenchComponent : public Component
+	{
+	public:
+		int value = N;
+	};
+
+	//------------------------------
+	// 오브젝트 N개를 무작위로 배치한 AoiGrid
+	// GameObject 생성에 필요한 Scene/GameThread는 소유만 하고 사용하지 않음
+	//------------------------------
+	struct AoiFixture
+	{
+		GameThread thread;
+		GameScene scene{ &thread, MAP_MIN, MAP_MIN, MAP_MAX, MAP_MAX, CELL_LEN, HYSTERESIS_BUFFER };
+		AoiGrid grid{ MAP_MIN, MAP_MIN, MAP_MAX, MAP_MAX, CELL_LEN, HYSTERESIS_BUFFER };
+		std::vector<std::unique_ptr<BenchObject>> objects;
+		std::vector<std::pair<float, float>> positions;
+		std::mt19937 rng{ 12345 };
+
+		explicit AoiFixture(int count)
+		{
+			std::uniform_real_distribution<float> dist(MAP_MIN, MAP_MAX);
+			for (int i = 0; i < count; i++)
+			{
+				float x = dist(rng);
+				float z = dist(rng);
+				objects.push_back(std::make_unique<BenchObject>(&scene, x, z));
+				positions.emplace_back(x, z);
+				grid.AddObject(objects.back().get());
+			}
+		}
+	};
+}
+
+//------------------------------
+// AoiGrid
+//------------------------------
+
+// 매 반복마다 한 오브젝트를 무작위 방향으로 이동 (대부분 셀 유지, 일부 셀 이동 + Appear/Disappear)
+static void BM_AoiGrid_UpdatePosition(benchmark::State& state)
+{
+	AoiFixture fixture(static_cast<int>(state.range(0)));
+	std::uniform_int_distribution<size_t> pick(0, fixture.objects.size() - 1);
+	std::uniform_real_distribution<float> step(-MOVE_STEP, MOVE_STEP);
+
+	for (auto _ : state)
+	{
+		size_t index = pick(fixture.rng);
+		auto& [x, z] = fixture.positions[index];
+		x = (std::min)((std::max)(x + step(fixture.rng), MAP_MIN), MAP_MAX - 0.01f);
+		z = (std::min)((std::max)(z + step(fixture.rng), MAP_MIN), MAP_MAX - 0.01f);
+		fixture.grid.UpdatePosition(fixture.objects[index].get(), x, z);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AoiGrid_UpdatePosition)->Arg(100)->Arg(1000)->Arg(5000);
+
+static void BM_AoiGrid_GetNearbyObjects(benchmark::State& state)
+{
+	AoiFixture fixture(static_cast<int>(state.range(0)));
+	std::uniform_int_distribution<size_t> pick(0, fixture.objects.size() - 1);
+
+	size_t found = 0;
+	for (auto _ : state)
+	{
+		size_t index = pick(fixture.rng);
+		const auto& [x, z] = fixture.positions[index];
+		auto nearby = fixture.grid.GetNearbyObjects(x, z, fixture.objects[index].get());
+		found += nearby.size();
+		benchmark::DoNotOptimize(nearby.data());
+	}
+	state.SetItemsProcessed(state.iterations());
+	state.counters["nearby"] = benchmark::Counter(static_cast<double>(found), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_AoiGrid_GetNearbyObjects)->Arg(100)->Arg(1000)->Arg(5000);
+
+static void BM_AoiGrid_ForEachAdjacent(benchmark::State& state)
+{
+	AoiFixture fixture(static_cast<int>(state.range(0)));
+	std::uniform_int_distribution<size_t> pick(0, fixture.objects.size() - 1);
+
+	size_t visited = 0;
+	for (auto _ : state)
+	{
+		const auto& [x, z] = fixture.positions[pick(fixture.rng)];
+		fixture.grid.ForEachAdjacentObjects(x, z, [&](GameObject* o)
+		{
+			benchmark::DoNotOptimize(o);
+			visited++;
+		});
+	}
+	state.SetItemsProcessed(state.iterations());
+	state.counters["nearby"] = benchmark::Counter(static_cast<double>(visited), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_AoiGrid_ForEachAdjacent)->Arg(100)->Arg(1000)->Arg(5000);
+
+//------------------------------
+// Event
+//------------------------------
+
+// Invoke는 핸들러 맵을 복사한 뒤 순회하므로 구독자 수에 따른 비용 증가를 확인
+static void BM_Event_Invoke(benchmark::State& state)
+{
+	Event<int> event;
+	std::vector<Subscription> subscriptions;
+	int64_t sum = 0;
+	for (int64_t i = 0; i < state.range(0); i++)
+	{
+		subscriptions.push_back(event.Subscribe([&sum](int value) { sum += value; }));
+	}
+
+	for (auto _ : state)
+	{
+		event.Invoke(1);
+	}
+	benchmark::DoNotOptimize(sum);
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Event_Invoke)->Arg(0)->Arg(1)->Arg(4)->Arg(16);
+
+//------------------------------
+// Entity::GetComponent
+//------------------------------
+
+static void BM_Entity_GetComponent(benchmark::State& state)
+{
+	Entity entity;
+	entity.AddComponent<BenchComponent<0>>();
+	entity.AddComponent<BenchComponent<1>>();
+	entity.AddComponent<BenchComponent<2>>();
+	entity.AddComponent<BenchComponent<3>>();
+	entity.AddComponent<BenchComponent<4>>();
+	entity.AddComponent<BenchComponent<5>>();
+	entity.AddComponent<BenchComponent<6>>();
+	entity.AddComponent<BenchComponent<7>>();
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(entity.GetComponent<BenchComponent<5>>());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Entity_GetComponent);
+
+static void BM_Entity_GetComponentMiss(benchmark::State& state)
+{
+	Entity entity;
+	entity.AddComponent<BenchComponent<0>>();
+	entity.AddComponent<BenchComponent<1>>();
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(entity.GetComponent<BenchComponent<7>>());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Entity_GetComponentMiss);
+
+//------------------------------
+// Job (std::function 대비)
+//------------------------------
+
+// 캡처 크기별 생성 + 이동 + 실행 비용
+// 96 = Player* + game::Pos 2개 수준 (인라인), 200 = 256 블록 풀, 2000 = new
+template<size_t CaptureSize>
+struct JobCapture
+{
+	char bytes[CaptureSize];
+};
+
+template<size_t CaptureSize>
+static void BM_Job_MoveInvoke(benchmark::State& state)
+{
+	JobCapture<CaptureSize> capture{};
+	uint64_t executed = 0;
+
+	for (auto _ : state)
+	{
+		Job job([capture, &executed]() { executed += capture.bytes[0] + 1; });
+		Job moved = std::move(job);
+		moved();
+	}
+	benchmark::DoNotOptimize(executed);
+}
+BENCHMARK_TEMPLATE(BM_Job_MoveInvoke, 16);
+BENCHMARK_TEMPLATE(BM_Job_MoveInvoke, 96);
+BENCHMARK_TEMPLATE(BM_Job_MoveInvoke, 200);
+BENCHMARK_TEMPLATE(BM_Job_MoveInvoke, 2000);
+
+template<size_t CaptureSize>
+static void BM_StdFunction_MoveInvoke(benchmark::State& state)
+{
+	JobCapture<CaptureSize> capture{};
+	uint64_t executed = 0;
+
+	for (auto _ : state)
+	{
+		std::function<void()> job([capture, &executed]() { executed += capture.bytes[0] + 1; });
+		std::function<void()> moved = std::move(job);
+		moved();
+	}
+	benchmark::DoNotOptimize(executed);
+}
+BENCHMARK_TEMPLATE(BM_StdFunction_MoveInvoke, 16);
+BENCHMARK_TEMPLATE(BM_StdFunction_MoveInvoke, 96);
+BENCHMARK_TEMPLATE(BM_StdFunction_MoveInvoke, 200);
+BENCHMARK_TEMPLATE(BM_StdFunction_MoveInvoke, 2000);
+
+//------------------------------
+// JobObject::PostJob / Flush
+//------------------------------
+
+// 단일 스레드: batch개 PostJob 후 JobThread 큐를 비움 (스케줄 CAS + Job 실행 비용)
+static void BM_JobObject_PostFlush(benchmark::State& state)
+{
+	BenchJobThread thread;
+	JobObject object(&thread);
+	const int64_t batch = state.range(0);
+	uint64_t executed = 0;
+
+	for (auto _ : state)
+	{
+		for (int64_t i = 0; i < batch; i++)
+		{
+			object.PostJob([&executed]() { executed++; });
+		}
+		thread.Drain();
+	}
+	benchmark::DoNotOptimize(executed);
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_JobObject_PostFlush)->Arg(1)->Arg(16)->Arg(256);
+
+// 경합: N개 스레드가 같은 JobObject에 PostJob, 전용 소비 스레드 하나가 계속 Flush
+// 측정 구간 시작/종료는 스레드 간 배리어로 동기화되므로 소비 스레드는 0번 스레드가 관리
+static void BM_JobObject_PostContended(benchmark::State& state)
+{
+	static BenchJobThread thread;
+	static JobObject object(&thread);
+	static std::atomic<bool> draining{ false };
+	static std::thread consumer;
+	static uint64_t executed = 0;
+
+	if (state.thread_index() == 0)
+	{
+		draining.store(true);
+		consumer = std::thread([]()
+		{
+			while (draining.load(std::memory_order_relaxed))
+			{
+				thread.Drain();
+			}
+		});
+	}
+
+	for (auto _ : state)
+	{
+		object.PostJob([]() { executed++; });
+	}
+
+	if (state.thread_index() == 0)
+	{
+		draining.store(false);
+		consumer.join();
+		thread.Drain();
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CONTENDED(BM_JobObject_PostContended);
+
+// 코어 스레드 처리량: 매니저형 JobObject 여러 개에 외부 스레드가 Job을 뿌리고 전부 처리될 때까지
+// Arg 0 = 단일 JobThread, N = JobThreadPool 워커 N개
+static void BM_CoreThread_ManagerThroughput(benchmark::State& state)
+{
+	constexpr int OBJECT_COUNT = 64;
+	constexpr int JOBS_PER_ITERATION = 4096;
+	constexpr int JOB_WORK = 256;	// Job당 연산량 (매니저 조회/갱신 흉내)
+
+	std::unique_ptr<JobThreadBase> thread;
+	if (state.range(0) > 0)
+	{
+		thread = std::make_unique<JobThreadPool>(static_cast<int>(state.range(0)));
+	}
+	else
+	{
+		thread = std::make_unique<JobThread>();
+	}
+	thread->Start();
+
+	std::vector<std::unique_ptr<JobObject>> objects;
+	for (int i = 0; i < OBJECT_COUNT; i++)
+	{
+		objects.push_back(std::make_unique<JobObject>(thread.get()));
+	}
+
+	std::atomic<int> remaining{ 0 };
+	for (auto _ : state)
+	{
+		remaining.store(JOBS_PER_ITERATION);
+		for (int i = 0; i < JOBS_PER_ITERATION; i++)
+		{
+			objects[i % OBJECT_COUNT]->PostJob([&remaining]()
+			{
+				uint64_t acc = 0;
+				for (int k = 0; k < JOB_WORK; k++)
+				{
+					acc += static_cast<uint64_t>(k) * k;
+				}
+				benchmark::DoNotOptimize(acc);
+				remaining.fetch_sub(1, std::memory_order_release);
+			});
+		}
+
+		while (remaining.load(std::memory_order_acquire) > 0)
+		{
+			YieldProcessor();
+		}
+	}
+
+	thread->Stop();
+	state.SetItemsProcessed(state.iterations() * JOBS_PER_ITERATION);
+}
+BENCHMARK(BM_CoreThread_ManagerThroughput)->Arg(0)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+//------------------------------
+// JobTask 코루틴 vs 중첩 PostJob
+//------------------------------
+
+namespace
+{
+	JobTask CallRoundTrip(JobObject* caller, JobObject* target, uint64_t& result)
+	{
+		co_await caller->Switch();
+		const uint64_t value = co_await target->Call([]() { return uint64_t{ 1 }; });
+		result += value;
+	}
+}
+
+// 단일 스레드: caller -> target -> caller 왕복 1회 (Job 3개 + 코루틴 프레임 1개)
+static void BM_JobTask_CallRoundTrip(benchmark::State& state)
+{
+	BenchJobThread thread;
+	JobObject caller(&thread);
+	JobObject target(&thread);
+	uint64_t result = 0;
+
+	for (auto _ : state)
+	{
+		CallRoundTrip(&caller, &target, result);
+		thread.Drain();
+	}
+	benchmark::DoNotOptimize(result);
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_JobTask_CallRoundTrip);
+
+// 같은 흐름을 람다 중첩으로 (Job 3개, 캡처는 모두 인라인)
+static void BM_JobObject_NestedPostRoundTrip(benchmark::State& state)
+{
+	BenchJobThread thread;
+	JobObject caller(&thread);
+	JobObject target(&thread);
+	uint64_t result = 0;
+
+	for (auto _ : state)
+	{
+		caller.PostJob([&caller, &target, &result]()
+		{
+			target.PostJob([&caller, &result]()
+			{
+				const uint64_t value = 1;
+				caller.PostJob([&result, value]() { result += value; });
+			});
+		});
+		thread.Drain();
+	}
+	benchmark::DoNotOptimize(result);
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_JobObject_NestedPostRoundTrip);
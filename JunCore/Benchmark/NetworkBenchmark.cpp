@@ -0,0 +1,51 @@
+﻿#include "BenchmarkCommon.h"
+#include "../JunCommon/network/ProtocolBuffer.h"
+#include <cstdint>
+#include <vector>
+
+//------------------------------
+// ProtocolBuffer 직렬화/역직렬화
+// RingBuffer.h와 BUF_SIZE 매크로가 겹치므로 별도 번역 단위에서 측정
+//------------------------------
+
+// 고정 필드 묶음 (이동 패킷 수준: id + 좌표 + 시각)
+static void BM_ProtocolBuffer_Fields(benchmark::State& state)
+{
+	ProtocolBuffer buffer;
+
+	int32_t id = 0;
+	float x = 0.f, y = 0.f, z = 0.f;
+	long long timestamp = 0;
+	unsigned short type = 0;
+
+	for (auto _ : state)
+	{
+		buffer.Clear();
+		buffer << static_cast<unsigned short>(7) << id << 1.f << 2.f << 3.f << static_cast<long long>(id);
+		buffer >> type >> id >> x >> y >> z >> timestamp;
+		id++;
+		benchmark::DoNotOptimize(timestamp);
+	}
+	state.SetBytesProcessed(state.iterations() *
+		static_cast<int64_t>(sizeof(type) + sizeof(id) + sizeof(x) * 3 + sizeof(timestamp)));
+}
+BENCHMARK(BM_ProtocolBuffer_Fields);
+
+// 가변 길이 페이로드 Put_Data / Get_Data
+static void BM_ProtocolBuffer_PutGetData(benchmark::State& state)
+{
+	ProtocolBuffer buffer;
+	const int size = static_cast<int>(state.range(0));
+	std::vector<char> src(static_cast<size_t>(size), 'x');
+	std::vector<char> dst(static_cast<size_t>(size));
+
+	for (auto _ : state)
+	{
+		buffer.Clear();
+		buffer.Put_Data(src.data(), size);
+		buffer.Get_Data(dst.data(), size);
+		benchmark::DoNotOptimize(dst.data());
+	}
+	state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_ProtocolBuffer_PutGetData)->RangeMultiplier(4)->Range(16, 2048);
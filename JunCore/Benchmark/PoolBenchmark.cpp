@@ -0,0 +1,82 @@
+﻿#include "BenchmarkCommon.h"
+#include "../JunCommon/pool/LFObjectPool.h"
+#include "../JunCommon/pool/LFObjectPoolTLS.h"
+#include <cstdint>
+#include <vector>
+
+//------------------------------
+// LFObjectPool / LFObjectPoolTLS
+// Alloc -> Free 왕복 비용. 경합 케이스는 모든 스레드가 같은 풀을 공유
+//------------------------------
+
+namespace
+{
+	struct Payload
+	{
+		uint64_t data[8];	// 64바이트 (패킷/잡 객체 수준)
+	};
+}
+
+static void BM_LFObjectPool_AllocFree(benchmark::State& state)
+{
+	static LFObjectPool<Payload> pool;
+
+	for (auto _ : state)
+	{
+		Payload* p = pool.Alloc();
+		benchmark::DoNotOptimize(p);
+		pool.Free(p);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CONTENDED(BM_LFObjectPool_AllocFree);
+
+static void BM_LFObjectPoolTLS_AllocFree(benchmark::State& state)
+{
+	static LFObjectPoolTLS<Payload> pool;
+
+	for (auto _ : state)
+	{
+		Payload* p = pool.Alloc();
+		benchmark::DoNotOptimize(p);
+		pool.Free(p);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CONTENDED(BM_LFObjectPoolTLS_AllocFree);
+
+// 비교 기준: 기본 힙 할당
+static void BM_NewDelete(benchmark::State& state)
+{
+	for (auto _ : state)
+	{
+		Payload* p = new Payload;
+		benchmark::DoNotOptimize(p);
+		delete p;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CONTENDED(BM_NewDelete);
+
+// 여러 개를 잡았다가 한꺼번에 반환 (프리리스트 깊이가 변하는 경우)
+static void BM_LFObjectPoolTLS_Burst(benchmark::State& state)
+{
+	static LFObjectPoolTLS<Payload> pool;
+	const int64_t burst = state.range(0);
+	std::vector<Payload*> held(static_cast<size_t>(burst));
+
+	for (auto _ : state)
+	{
+		for (auto& p : held)
+		{
+			p = pool.Alloc();
+		}
+		benchmark::DoNotOptimize(held.data());
+		for (auto* p : held)
+		{
+			pool.Free(p);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * burst);
+}
+BENCHMARK(BM_LFObjectPoolTLS_Burst)->Arg(64)->Arg(1024)->ThreadRange(1, MAX_CONTENDED_THREADS)->UseRealTime();
@@ -0,0 +1,39 @@
+﻿#include "BenchmarkCommon.h"
+#include <cstring>
+#include <vector>
+
+// Benchmark [google benchmark 옵션...]
+// --benchmark_out 미지정 시 benchmark_results.json 으로 결과 저장 (compare.py로 빌드 간 회귀 비교)
+int main(int argc, char* argv[])
+{
+	static char defaultOut[] = "--benchmark_out=benchmark_results.json";
+	static char defaultFormat[] = "--benchmark_out_format=json";
+
+	std::vector<char*> args(argv, argv + argc);
+
+	bool hasOut = false;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strncmp(argv[i], "--benchmark_out=", strlen("--benchmark_out=")) == 0)
+		{
+			hasOut = true;
+		}
+	}
+
+	if (!hasOut)
+	{
+		args.push_back(defaultOut);
+		args.push_back(defaultFormat);
+	}
+
+	int benchArgc = static_cast<int>(args.size());
+	benchmark::Initialize(&benchArgc, args.data());
+	if (benchmark::ReportUnrecognizedArguments(benchArgc, args.data()))
+	{
+		return 1;
+	}
+
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	return 0;
+}
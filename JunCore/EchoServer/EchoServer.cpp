@@ -30,6 +30,7 @@ void EchoServer::HandleEchoRequest(User& user, const echo::EchoRequest& request)
 	
 	echo::EchoResponse response;
 	response.set_message(request.message());
+	response.set_timestamp(request.timestamp());
 	user.SendPacket(response);
 
 	return;
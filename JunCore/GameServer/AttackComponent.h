@@ -1,12 +1,16 @@
 ﻿#pragma once
 #include "../JunCore/logic/Component.h"
-#include "../JunCore/logic/Time.h"
+#include "../JunCore/logic/JobObject.h"
 #include "../JunCore/core/Event.h"
+#include <chrono>
 
 //--------------------------------------------------------------
 // AttackComponent - 공격 상태 머신 컴포넌트
 // 상태: Idle -> Attacking (딜레이 대기) -> 데미지 적용 -> Idle
 // 이벤트: OnDamageApply (target_id, damage)
+//
+// 선딜은 owner JobObject의 지연 Job으로 처리 (FixedUpdate마다 누적하지 않음)
+// 취소/재시작 시 공격 세대를 올려서 이전 지연 Job은 무시됨
 //--------------------------------------------------------------
 class AttackComponent : public Component
 {
@@ -17,37 +21,31 @@ public:
     Event<int32_t, int32_t> OnDamageApply;  // (target_id, damage)
 
 public:
-    AttackComponent() = default;
+    // jobOwner: 지연 Job을 실행할 JobObject (컴포넌트를 소유한 GameObject)
+    explicit AttackComponent(JobObject* jobOwner) : m_pJobOwner(jobOwner) {}
     ~AttackComponent() override = default;
 
     //----------------------------------------------------------
-    // Component 인터페이스
+    // 공격 시작 (owner의 Job 안에서 호출)
     //----------------------------------------------------------
-    void OnFixedUpdate() override
+    void StartAttack(int32_t target_id)
     {
-        if (m_state != State::Attacking)
-        {
-            return;
-        }
-
-        m_elapsed += Time::fixedDeltaTime();
+        m_targetId = target_id;
+        m_state = State::Attacking;
 
-        if (m_elapsed >= DAMAGE_DELAY)
+        // 지연 Job은 owner 큐에서 실행되므로 owner가 살아있는 동안만 실행됨 (this 캡처 안전)
+        const uint32_t generation = ++m_generation;
+        m_pJobOwner->PostJobAfter(DAMAGE_DELAY, [this, generation]()
         {
+            if (m_state != State::Attacking || m_generation != generation)
+            {
+                return;
+            }
+
             // 데미지 적용 이벤트 발행
-            OnDamageApply(m_targetId, DAMAGE_AMOUNT);
             m_state = State::Idle;
-        }
-    }
-
-    //----------------------------------------------------------
-    // 공격 시작
-    //----------------------------------------------------------
-    void StartAttack(int32_t target_id)
-    {
-        m_targetId = target_id;
-        m_elapsed = 0.0f;
-        m_state = State::Attacking;
+            OnDamageApply(m_targetId, DAMAGE_AMOUNT);
+        });
     }
 
     //----------------------------------------------------------
@@ -56,6 +54,7 @@ public:
     void CancelAttack()
     {
         m_state = State::Idle;
+        ++m_generation;
     }
 
     //----------------------------------------------------------
@@ -66,12 +65,13 @@ public:
 private:
     enum class State { Idle, Attacking };
 
+    JobObject* m_pJobOwner;
     State m_state{State::Idle};
     int32_t m_targetId{0};
-    float m_elapsed{0.0f};
+    uint32_t m_generation{0};
 
     // 공격 모션 선딜 (데미지 적용까지 딜레이)
-    static constexpr float DAMAGE_DELAY = 0.33f;
+    static constexpr std::chrono::milliseconds DAMAGE_DELAY{330};
 
     // 데미지량
     static constexpr int32_t DAMAGE_AMOUNT = 1;
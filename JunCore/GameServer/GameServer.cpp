@@ -60,6 +60,18 @@ void GameServer::RegisterPacketHandlers()
 	{
 		this->HandleAttackRequest(user, request);
 	});
+
+	// 송신 우선순위: 현재 모든 GC 메시지는 NORMAL 레인 하나에 둠 (RegisterSendPriority 미사용)
+	// 씬 진입/입장/퇴장/이동/전투/위치 보정은 모두 같은 플레이어에 대한 상태라 서로 순서에 의존함
+	// (레인을 나누면 DISAPPEAR가 앞선 APPEAR를 추월하거나 APPEAR 전에 ATTACK/DAMAGE가 도착)
+	// 순서 의존이 없는 타입(채팅 등)이 생기면 그때 CRITICAL/BULK로 등록
+
+	// 수신 제한 (한 클라이언트가 Worker/JobQueue를 독점하지 못하도록)
+	// 세션 전체: 초당 100개, 초과 시 연결 종료 (정상 클라이언트는 도달 불가)
+	SetSessionIngressLimit({ 100.0, 200.0, IngressAction::DISCONNECT });
+	// 이동/공격: 초당 20/10개, 초과분은 보류 (TCP backpressure)
+	RegisterIngressLimit<game::CG_MOVE_REQ>({ 20.0, 20.0, IngressAction::DEFER });
+	RegisterIngressLimit<game::CG_ATTACK_REQ>({ 10.0, 5.0, IngressAction::DEFER });
 }
 
 void GameServer::SendError(User& user, game::ErrorCode error_code, const std::string& error_message)
@@ -0,0 +1,559 @@
+﻿#include "GameSimulation.h"
+#include "Player.h"
+#include "../JunCore/logic/GameScene.h"
+#include "../JunCore/logic/GameObjectManager.h"
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <thread>
+
+namespace
+{
+	// 맵/AOI 설정 (GameServer.cpp와 동일하게 유지)
+	constexpr float MAP_MIN = -40.0f;
+	constexpr float MAP_MAX =  40.0f;
+	constexpr float CELL_LEN = 10.0f;
+	constexpr float HYSTERESIS_BUFFER = 0.5f;
+	constexpr float EDGE_MARGIN = 1.0f;
+	constexpr float CLUSTER_CENTER = CELL_LEN * 0.5f;	// CLUSTER 패턴 밀집 셀 중심 (x, z 동일)
+	constexpr float ATTACK_RANGE = 7.0f;				// Player::ATTACK_RANGE
+
+	constexpr int DRIVER_TICK_MS = 5;
+	constexpr int REPORT_INTERVAL_SECONDS = 1;
+
+	float ClampToMap(float v)
+	{
+		return (std::clamp)(v, MAP_MIN + EDGE_MARGIN, MAP_MAX - EDGE_MARGIN);
+	}
+
+	double NsToMs(uint64_t ns)
+	{
+		return ns / 1000000.0;
+	}
+
+	void MergeFrameStats(GameThread::FrameStats& total, const GameThread::FrameStats& stats)
+	{
+		total.frames += stats.frames;
+		total.fixedSteps += stats.fixedSteps;
+		total.jobNs += stats.jobNs;
+		total.fixedUpdateNs += stats.fixedUpdateNs;
+		total.updateNs += stats.updateNs;
+		total.budgetYields += stats.budgetYields;
+		total.frameWorkUs.Merge(stats.frameWorkUs);
+	}
+
+	void PrintJobStats(const char* label, const JobStatsCounters::Snapshot& stats)
+	{
+		printf("  %-24s %8llu jobs | wait %llu, %llu, %llu | run %llu, %llu, %llu | flush %llu | depth %llu, %llu\n",
+			label, stats.runUs.count,
+			stats.waitUs.ValueAtPercentile(50.0), stats.waitUs.ValueAtPercentile(99.0), stats.waitUs.max,
+			stats.runUs.ValueAtPercentile(50.0), stats.runUs.ValueAtPercentile(99.0), stats.runUs.max,
+			stats.jobsPerFlush.ValueAtPercentile(99.0),
+			stats.queueDepth.ValueAtPercentile(99.0), stats.queueDepth.max);
+	}
+}
+
+bool SimulationConfig::ParsePattern(const char* name, SimPattern& out)
+{
+	if (strcmp(name, "uniform") == 0)		{ out = SimPattern::UNIFORM; return true; }
+	if (strcmp(name, "cluster") == 0)		{ out = SimPattern::CLUSTER; return true; }
+	if (strcmp(name, "border") == 0)		{ out = SimPattern::BORDER; return true; }
+	return false;
+}
+
+const char* SimulationConfig::PatternName(SimPattern pattern)
+{
+	switch (pattern)
+	{
+	case SimPattern::UNIFORM:	return "uniform";
+	case SimPattern::CLUSTER:	return "cluster";
+	case SimPattern::BORDER:	return "border";
+	}
+	return "unknown";
+}
+
+//------------------------------
+// SimulationUser
+//------------------------------
+bool GameSimulation::SimulationUser::SendWithoutSession(uint32_t packet_id, const google::protobuf::Message& packet, uint64_t coalesce_key)
+{
+	const auto start = Clock::now();
+
+	const size_t payloadSize = packet.ByteSizeLong();
+	if (serialize_)
+	{
+		// 실제 송신 경로와 같은 직렬화 비용 (버퍼는 스레드별 재사용)
+		thread_local std::vector<char> buffer;
+		buffer.resize(UNIFIED_HEADER_SIZE + payloadSize);
+		InitializePacketHeader(reinterpret_cast<UnifiedPacketHeader*>(buffer.data()), static_cast<uint32_t>(buffer.size()), packet_id);
+		packet.SerializeToArray(buffer.data() + UNIFIED_HEADER_SIZE, static_cast<int>(payloadSize));
+	}
+
+	bytes.fetch_add(UNIFIED_HEADER_SIZE + payloadSize, std::memory_order_relaxed);
+	packets.fetch_add(1, std::memory_order_relaxed);
+	totals_.packets[ClassifyPacket(packet_id)].fetch_add(1, std::memory_order_relaxed);
+	totals_.sinkNs.fetch_add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count()), std::memory_order_relaxed);
+	return true;
+}
+
+GameSimulation::PacketKind GameSimulation::ClassifyPacket(uint32_t packet_id)
+{
+	static const uint32_t ids[] = {
+		PACKET_ID(game::GC_MOVE_NOTIFY),
+		PACKET_ID(game::GC_MOVE_STOP_NOTIFY),
+		PACKET_ID(game::GC_PLAYER_APPEAR_NOTIFY),
+		PACKET_ID(game::GC_PLAYER_DISAPPEAR_NOTIFY),
+		PACKET_ID(game::GC_ATTACK_NOTIFY),
+		PACKET_ID(game::GC_DAMAGE_NOTIFY),
+		PACKET_ID(game::GC_POSITION_SYNC_NOTIFY),
+	};
+
+	for (int i = 0; i < static_cast<int>(std::size(ids)); i++)
+	{
+		if (ids[i] == packet_id)
+		{
+			return static_cast<PacketKind>(i);
+		}
+	}
+	return PACKET_OTHER;
+}
+
+//------------------------------
+// GameSimulation
+//------------------------------
+GameSimulation::GameSimulation(const SimulationConfig& config)
+	: config_(config)
+{
+	config_.botCount = (std::max)(1, config_.botCount);
+	config_.sceneCount = (std::max)(1, config_.sceneCount);
+	config_.gameThreadCount = (std::max)(1, config_.gameThreadCount);
+	config_.coreThreadCount = (std::max)(1, config_.coreThreadCount);
+	config_.actionIntervalMs = (std::max)(1, config_.actionIntervalMs);
+}
+
+GameSimulation::~GameSimulation()
+{
+	Teardown();
+}
+
+void GameSimulation::Setup()
+{
+	// Server::StartGameThreads와 같은 구성 (코어 JobThread + GameThread N개)
+	if (config_.coreThreadCount > 1)
+	{
+		coreThread_ = std::make_unique<JobThreadPool>(config_.coreThreadCount);
+	}
+	else
+	{
+		coreThread_ = std::make_unique<JobThread>();
+	}
+	for (int i = 0; i < config_.gameThreadCount; i++)
+	{
+		auto thread = std::make_unique<GameThread>();
+		JobFlushBudget budget = thread->GetFlushBudget();
+		if (config_.flushMaxJobs >= 0)
+		{
+			budget.maxJobs = static_cast<uint32_t>(config_.flushMaxJobs);
+		}
+		if (config_.flushMaxUs >= 0)
+		{
+			budget.maxTime = std::chrono::microseconds(config_.flushMaxUs);
+		}
+		thread->SetFlushBudget(budget);
+		gameThreads_.push_back(std::move(thread));
+	}
+
+	// 씬 등록은 GameThread 시작 전에 (m_scenes는 GameThread 전용)
+	for (int i = 0; i < config_.sceneCount; i++)
+	{
+		scenes_.push_back(std::make_unique<GameScene>(gameThreads_[i % config_.gameThreadCount].get(),
+			MAP_MIN, MAP_MIN, MAP_MAX, MAP_MAX, CELL_LEN, HYSTERESIS_BUFFER));
+	}
+
+	JobStats::SetEnabled(config_.jobStats);
+	coreThread_->Start();
+	GameObjectManager::Instance().Initialize(coreThread_.get());
+	for (auto& thread : gameThreads_)
+	{
+		thread->Start();
+	}
+
+	const auto now = Clock::now();
+	std::uniform_int_distribution<> offsetDist(0, config_.actionIntervalMs - 1);
+
+	for (int i = 0; i < config_.botCount; i++)
+	{
+		auto bot = std::make_unique<SimBot>();
+		SeedBot(*bot, i);
+		bot->user = std::make_unique<SimulationUser>(sinkTotals_, config_.serializePackets);
+		bot->scene = scenes_[i % config_.sceneCount].get();
+		bot->nextActionTime = now + std::chrono::milliseconds(offsetDist(bot->rng));
+
+		std::lock_guard<std::mutex> lock(bot->lock);
+		SpawnPlayer(*bot);
+		bots_.push_back(std::move(bot));
+	}
+
+	totalFrameStats_.assign(gameThreads_.size(), GameThread::FrameStats{});
+}
+
+void GameSimulation::Teardown()
+{
+	if (!coreThread_)
+	{
+		return;
+	}
+
+	for (auto& bot : bots_)
+	{
+		std::lock_guard<std::mutex> lock(bot->lock);
+		if (bot->player)
+		{
+			bot->player->Destroy();
+			bot->player = nullptr;
+		}
+	}
+
+	// GameThread 정지 시 남은 Job(Exit/삭제)까지 처리됨
+	for (auto& thread : gameThreads_)
+	{
+		thread->Stop();
+	}
+	coreThread_->Stop();
+
+	scenes_.clear();
+	gameThreads_.clear();
+	bots_.clear();
+	coreThread_.reset();
+}
+
+void GameSimulation::SeedBot(SimBot& bot, int botIndex) const
+{
+	// 봇마다 독립 스트림 (GameThread 배치/실행 순서와 무관하게 봇의 입력 순서가 시드로 결정)
+	std::seed_seq seq{ static_cast<uint32_t>(config_.seed), static_cast<uint32_t>(config_.seed >> 32), static_cast<uint32_t>(botIndex) };
+	bot.rng.seed(seq);
+}
+
+void GameSimulation::SpawnPlayer(SimBot& bot)
+{
+	// bot.lock 보유 상태에서 호출
+	float x = 0.0f;
+	float z = 0.0f;
+	ChooseSpawnPosition(x, z, bot.rng);
+
+	const uint32_t playerId = nextPlayerId_.fetch_add(1);
+	bot.user->SetPlayerId(playerId);
+	bot.player = GameObjectManager::Instance().Create<Player>(bot.scene, bot.user.get(), playerId, x, 0.0f, z);
+	bot.user->SetPlayer(bot.player);
+}
+
+void GameSimulation::ChooseSpawnPosition(float& x, float& z, std::mt19937& rng) const
+{
+	if (config_.pattern == SimPattern::CLUSTER)
+	{
+		std::uniform_real_distribution<float> dist(-CELL_LEN * 0.5f + EDGE_MARGIN, CELL_LEN * 0.5f - EDGE_MARGIN);
+		x = CLUSTER_CENTER + dist(rng);
+		z = CLUSTER_CENTER + dist(rng);
+		return;
+	}
+
+	std::uniform_real_distribution<float> dist(MAP_MIN + EDGE_MARGIN, MAP_MAX - EDGE_MARGIN);
+	x = dist(rng);
+	z = dist(rng);
+}
+
+void GameSimulation::PostBotAction(SimBot& bot)
+{
+	// GameServer::HandleMoveRequest/HandleAttackRequest와 같이 Player Job으로 주입
+	std::lock_guard<std::mutex> lock(bot.lock);
+	if (Player* player = bot.player)
+	{
+		player->PostJob([this, &bot, player]()
+		{
+			RunBotAction(bot, player);
+		});
+	}
+}
+
+void GameSimulation::RunBotAction(SimBot& bot, Player* player)
+{
+	{
+		std::lock_guard<std::mutex> lock(bot.lock);
+		if (bot.player != player)
+		{
+			// 부활로 교체된 이전 Player에 남아있던 입력
+			return;
+		}
+
+		// 사망 -> 재접속과 같은 흐름 (삭제 후 새 Player 생성)
+		if (player->IsDead())
+		{
+			player->Destroy();
+			bot.user->ClearPlayer();
+			SpawnPlayer(bot);
+			respawns_.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+	}
+
+	// bot.rng는 현재 Player의 Job(직렬 실행)에서만 사용하므로 lock 밖에서 접근
+	std::mt19937& rng = bot.rng;
+	const game::Pos cur = player->GetCurrentPos();
+
+	std::uniform_int_distribution<> roll(1, 1000);
+	if (roll(rng) <= config_.attackPerThousand)
+	{
+		if (const int32_t targetId = FindAttackTarget(player, rng))
+		{
+			player->HandleAttack(cur, targetId);
+			attacksApplied_.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+	}
+
+	game::Pos dest;
+	ChooseDestination(bot, cur, dest, rng);
+	player->HandleSetDestPos(cur, dest);
+	movesApplied_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void GameSimulation::ChooseDestination(SimBot& bot, const game::Pos& cur, game::Pos& dest, std::mt19937& rng) const
+{
+	dest.set_y(0.0f);
+
+	switch (config_.pattern)
+	{
+	case SimPattern::UNIFORM:
+	{
+		std::uniform_real_distribution<float> dist(MAP_MIN + EDGE_MARGIN, MAP_MAX - EDGE_MARGIN);
+		dest.set_x(dist(rng));
+		dest.set_z(dist(rng));
+		break;
+	}
+	case SimPattern::CLUSTER:
+	{
+		std::uniform_real_distribution<float> dist(-CELL_LEN * 0.5f + EDGE_MARGIN, CELL_LEN * 0.5f - EDGE_MARGIN);
+		dest.set_x(ClampToMap(CLUSTER_CENTER + dist(rng)));
+		dest.set_z(ClampToMap(CLUSTER_CENTER + dist(rng)));
+		break;
+	}
+	case SimPattern::BORDER:
+	{
+		float nextX = cur.x() + bot.marchDir * CELL_LEN;
+		if (nextX < MAP_MIN + EDGE_MARGIN || MAP_MAX - EDGE_MARGIN < nextX)
+		{
+			bot.marchDir = -bot.marchDir;
+			nextX = cur.x() + bot.marchDir * CELL_LEN;
+		}
+		dest.set_x(ClampToMap(nextX));
+		dest.set_z(cur.z());
+		break;
+	}
+	}
+}
+
+int32_t GameSimulation::FindAttackTarget(Player* player, std::mt19937& rng) const
+{
+	GameScene* scene = player->GetScene();
+	if (scene == nullptr)
+	{
+		return 0;
+	}
+
+	std::vector<int32_t> candidates;
+	const float x = player->GetX();
+	const float z = player->GetZ();
+	scene->ForEachAdjacentObjects(player, false, [&](GameObject* obj)
+	{
+		Player* other = dynamic_cast<Player*>(obj);
+		if (other == nullptr)
+		{
+			return;
+		}
+
+		const float dx = other->GetX() - x;
+		const float dz = other->GetZ() - z;
+		if (!other->IsDead() && dx * dx + dz * dz <= ATTACK_RANGE * ATTACK_RANGE)
+		{
+			candidates.push_back(static_cast<int32_t>(other->GetPlayerId()));
+		}
+	});
+
+	if (candidates.empty())
+	{
+		return 0;
+	}
+
+	std::uniform_int_distribution<size_t> pick(0, candidates.size() - 1);
+	return candidates[pick(rng)];
+}
+
+void GameSimulation::Run()
+{
+	printf("=== Game Simulation ===\n"
+	       "Bots: %d, scenes: %d, game threads: %d, core threads: %d, pattern: %s\n"
+	       "Action interval: %dms, attack: %d/1000, duration: %ds, serialize: %s, flood: %d jobs/tick, seed: %llu\n",
+	       config_.botCount, config_.sceneCount, config_.gameThreadCount, config_.coreThreadCount, SimulationConfig::PatternName(config_.pattern),
+	       config_.actionIntervalMs, config_.attackPerThousand, config_.durationSeconds, config_.serializePackets ? "on" : "off",
+	       config_.floodJobsPerTick, static_cast<unsigned long long>(config_.seed));
+
+	Setup();
+
+	const auto start = Clock::now();
+	const auto end = start + std::chrono::seconds(config_.durationSeconds);
+	auto nextReport = start + std::chrono::seconds(REPORT_INTERVAL_SECONDS);
+	auto lastReport = start;
+
+	// 입력 주입 (클라이언트 패킷 도착 역할)
+	while (true)
+	{
+		const auto now = Clock::now();
+		if (end <= now)
+		{
+			break;
+		}
+
+		for (auto& bot : bots_)
+		{
+			if (bot->nextActionTime <= now)
+			{
+				bot->nextActionTime += std::chrono::milliseconds(config_.actionIntervalMs);
+				if (bot->nextActionTime < now)
+				{
+					bot->nextActionTime = now;
+				}
+				PostBotAction(*bot);
+			}
+		}
+
+		// 패킷을 폭주시키는 클라이언트 하나 (같은 GameThread의 나머지 봇 프레임 지연 확인용)
+		for (int i = 0; i < config_.floodJobsPerTick && !bots_.empty(); i++)
+		{
+			PostBotAction(*bots_[0]);
+		}
+
+		if (nextReport <= now)
+		{
+			Report(std::chrono::duration<double>(now - lastReport).count(), false);
+			lastReport = now;
+			nextReport += std::chrono::seconds(REPORT_INTERVAL_SECONDS);
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(DRIVER_TICK_MS));
+	}
+
+	Report(std::chrono::duration<double>(Clock::now() - lastReport).count(), true);
+	Teardown();
+}
+
+void GameSimulation::Report(double seconds, bool final)
+{
+	if (seconds <= 0.0)
+	{
+		return;
+	}
+	totalSeconds_ += seconds;
+
+	// 1. GameThread 프레임 단계별 비용 (구간 합계 ms, 스레드 시간 대비 %)
+	printf("[%6.1fs]\n", totalSeconds_);
+	for (size_t i = 0; i < gameThreads_.size(); i++)
+	{
+		const GameThread::FrameStats stats = gameThreads_[i]->TakeFrameStats();
+		MergeFrameStats(totalFrameStats_[i], stats);
+
+		const double busyMs = NsToMs(stats.jobNs + stats.fixedUpdateNs + stats.updateNs);
+		printf("  thread %zu: %llu frames, %llu fixed | job %.1fms, fixed %.1fms, update %.1fms (busy %.1f%%) | frame p50 %llu, p99 %llu, max %llu us | yield %llu\n",
+			i, stats.frames, stats.fixedSteps,
+			NsToMs(stats.jobNs), NsToMs(stats.fixedUpdateNs), NsToMs(stats.updateNs), busyMs / (seconds * 10.0),
+			stats.frameWorkUs.ValueAtPercentile(50.0), stats.frameWorkUs.ValueAtPercentile(99.0), stats.frameWorkUs.max,
+			stats.budgetYields);
+	}
+
+	// 2. 송신량 (SimulationUser 집계)
+	uint64_t bytesSum = 0;
+	uint64_t bytesMax = 0;
+	for (auto& bot : bots_)
+	{
+		const uint64_t bytes = bot->user->bytes.load(std::memory_order_relaxed);
+		bytesSum += bytes - bot->lastBytes;
+		bytesMax = (std::max)(bytesMax, bytes - bot->lastBytes);
+		bot->lastBytes = bytes;
+	}
+
+	double rates[PACKET_KIND_COUNT];
+	double totalRate = 0.0;
+	for (int i = 0; i < PACKET_KIND_COUNT; i++)
+	{
+		const uint64_t count = sinkTotals_.packets[i].load(std::memory_order_relaxed);
+		rates[i] = (count - lastPackets_[i]) / seconds;
+		totalRate += rates[i];
+		lastPackets_[i] = count;
+	}
+
+	const uint64_t moves = movesApplied_.load();
+	const uint64_t attacks = attacksApplied_.load();
+	const uint64_t sinkNs = sinkTotals_.sinkNs.load();
+
+	printf("  input: move %.0f/s, attack %.0f/s, respawn %llu (total)\n"
+	       "  send : %.0f pkt/s, %.2f MB/s, sink %.1fms | per bot avg %.2f KB/s, max %.2f KB/s\n"
+	       "         move %.0f, stop %.0f, appear %.0f, disappear %.0f, attack %.0f, damage %.0f, sync %.0f, other %.0f (pkt/s)\n",
+	       (moves - lastMoves_) / seconds, (attacks - lastAttacks_) / seconds, respawns_.load(),
+	       totalRate, bytesSum / seconds / (1024.0 * 1024.0), NsToMs(sinkNs - lastSinkNs_),
+	       bytesSum / seconds / bots_.size() / 1024.0, bytesMax / seconds / 1024.0,
+	       rates[PACKET_MOVE], rates[PACKET_MOVE_STOP], rates[PACKET_APPEAR], rates[PACKET_DISAPPEAR],
+	       rates[PACKET_ATTACK], rates[PACKET_DAMAGE], rates[PACKET_POSITION_SYNC], rates[PACKET_OTHER]);
+
+	lastMoves_ = moves;
+	lastAttacks_ = attacks;
+	lastSinkNs_ = sinkNs;
+
+	if (!final)
+	{
+		return;
+	}
+
+	// 3. 전체 요약 (프레임/고정 스텝당 평균 비용)
+	printf("\n=== Simulation Summary (%.1fs, %d bots, pattern %s, seed %llu) ===\n",
+		totalSeconds_, config_.botCount, SimulationConfig::PatternName(config_.pattern), static_cast<unsigned long long>(config_.seed));
+	for (size_t i = 0; i < totalFrameStats_.size(); i++)
+	{
+		const GameThread::FrameStats& total = totalFrameStats_[i];
+		const double frames = static_cast<double>((std::max)(uint64_t{1}, total.frames));
+		const double fixedSteps = static_cast<double>((std::max)(uint64_t{1}, total.fixedSteps));
+		printf("thread %zu: job %.1f us/frame, fixed update %.1f us/step, update %.1f us/frame | frame work p50 %llu, p99 %llu, p99.9 %llu, max %llu us | budget yields %llu\n",
+			i, total.jobNs / frames / 1000.0, total.fixedUpdateNs / fixedSteps / 1000.0, total.updateNs / frames / 1000.0,
+			total.frameWorkUs.ValueAtPercentile(50.0), total.frameWorkUs.ValueAtPercentile(99.0),
+			total.frameWorkUs.ValueAtPercentile(99.9), total.frameWorkUs.max, total.budgetYields);
+	}
+	uint64_t totalPackets = 0;
+	for (const auto& count : sinkTotals_.packets)
+	{
+		totalPackets += count.load();
+	}
+	printf("send: %llu packets total, sink %.1fms total\n", totalPackets, NsToMs(sinkNs));
+
+	if (!config_.jobStats)
+	{
+		return;
+	}
+
+	// 4. Job 계측 (실행 전체 구간, 대기 시간 p99 내림차순)
+	printf("jobs (wait / run us: p50, p99, max | jobs per flush p99 | queue depth p99, max):\n");
+	PrintJobStats("core thread", coreThread_->TakeJobStats());
+	for (size_t i = 0; i < gameThreads_.size(); i++)
+	{
+		char label[32];
+		snprintf(label, sizeof(label), "game thread %zu", i);
+		PrintJobStats(label, gameThreads_[i]->TakeJobStats());
+	}
+
+	std::vector<JobStats::TypeSnapshot> types = JobStats::TakeTypeSnapshots();
+	std::sort(types.begin(), types.end(), [](const JobStats::TypeSnapshot& a, const JobStats::TypeSnapshot& b)
+	{
+		return a.stats.waitUs.ValueAtPercentile(99.0) > b.stats.waitUs.ValueAtPercentile(99.0);
+	});
+	for (const auto& type : types)
+	{
+		PrintJobStats(type.typeName.c_str(), type.stats);
+	}
+}
@@ -0,0 +1,151 @@
+﻿#pragma once
+#include "../JunCore/network/User.h"
+#include "../JunCore/logic/GameThread.h"
+#include "../JunCore/logic/JobThread.h"
+#include "../JunCore/logic/JobThreadPool.h"
+#include "protocol/game_messages.pb.h"
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <random>
+#include <chrono>
+
+class Player;
+class GameScene;
+
+//------------------------------
+// 시뮬레이션 봇 밀집 패턴
+//------------------------------
+enum class SimPattern
+{
+	UNIFORM,	// 맵 전체에 고르게 분산
+	CLUSTER,	// 모든 봇이 AOI 셀 하나에 밀집
+	BORDER,		// X축으로 셀 한 칸씩 왕복 (셀 경계 통과 반복)
+};
+
+//------------------------------
+// SimulationConfig - 헤드리스 시뮬레이션 설정
+//------------------------------
+struct SimulationConfig
+{
+	int botCount			= 2000;
+	int sceneCount			= 1;	// 봇은 씬에 균등 분배, 씬은 GameThread에 라운드로빈 배치
+	int gameThreadCount		= 2;
+	int coreThreadCount		= 1;	// 2 이상이면 코어 스레드를 JobThreadPool로 구성
+	int actionIntervalMs	= 500;	// 봇당 이동/공격 입력 간격
+	int attackPerThousand	= 300;	// 입력 1회당 공격 시도 확률 (사거리 내 대상이 있을 때)
+	int durationSeconds		= 30;
+	SimPattern pattern		= SimPattern::UNIFORM;
+	bool serializePackets	= true;	// 가짜 송신에서도 직렬화 수행 (실제 송신 경로 CPU 비용 포함)
+	int floodJobsPerTick	= 0;	// 적대적 부하: 0번 봇 Player에 입력 tick마다 추가로 넣는 행동 Job 수
+	int flushMaxJobs		= -1;	// GameThread Flush 예산 (-1 = GameThread 기본값, 0 = 제한 없음)
+	int flushMaxUs			= -1;
+	bool jobStats			= false;	// Job 대기/실행 시간 계측 (JobStats) 후 요약에 타입별 출력
+	uint64_t seed			= 1;	// 봇별 난수 시드의 기준값 (같은 값이면 봇마다 같은 입력 순서 -> 실행 간 비교 가능)
+
+	static bool ParsePattern(const char* name, SimPattern& out);
+	static const char* PatternName(SimPattern pattern);
+};
+
+//------------------------------
+// GameSimulation - 소켓 없는 GameServer 로직 부하 측정
+// GameThread 위에 GameScene을 만들고 세션 없는 SimulationUser를 가진 Player N개를 스폰하여
+// 스크립트 입력(이동/공격)을 Job으로 주입, GameThread 프레임 단계별 비용과 송신량을 보고
+//------------------------------
+class GameSimulation
+{
+public:
+	explicit GameSimulation(const SimulationConfig& config);
+	~GameSimulation();
+
+	GameSimulation(const GameSimulation&) = delete;
+	GameSimulation& operator=(const GameSimulation&) = delete;
+
+	// 설정 시간 동안 실행 후 결과 출력 (블로킹)
+	void Run();
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	// 수신자별 송신량 집계 (소켓 대신 직렬화 + 카운트)
+	enum PacketKind
+	{
+		PACKET_MOVE, PACKET_MOVE_STOP, PACKET_APPEAR, PACKET_DISAPPEAR, PACKET_ATTACK, PACKET_DAMAGE, PACKET_POSITION_SYNC, PACKET_OTHER,
+		PACKET_KIND_COUNT
+	};
+
+	struct SinkTotals
+	{
+		std::atomic<uint64_t> packets[PACKET_KIND_COUNT] = {};
+		std::atomic<uint64_t> sinkNs{0};	// 직렬화/집계에 쓴 시간
+	};
+
+	//------------------------------
+	// SimulationUser - 세션 없는 User (송신은 직렬화 + 집계, 항상 연결 상태)
+	// 호출 스레드 = 송신 호출 스레드
+	//------------------------------
+	class SimulationUser : public User
+	{
+	public:
+		SimulationUser(SinkTotals& totals, bool serialize) : totals_(totals), serialize_(serialize) {}
+
+		std::atomic<uint64_t> bytes{0};
+		std::atomic<uint64_t> packets{0};
+
+	protected:
+		bool SendWithoutSession(uint32_t packet_id, const google::protobuf::Message& packet, uint64_t coalesce_key) override;
+		bool IsConnectedWithoutSession() const override { return true; }
+
+	private:
+		SinkTotals& totals_;
+		bool serialize_;
+	};
+
+	struct SimBot
+	{
+		std::mutex lock;	// player 교체(부활)와 Driver의 PostJob 사이 보호
+		Player* player = nullptr;
+		std::unique_ptr<SimulationUser> user;
+		GameScene* scene = nullptr;
+		float marchDir = 1.0f;	// BORDER 패턴 진행 방향 (GameThread에서만 접근)
+		std::mt19937 rng;		// config.seed + 봇 번호로 시드, 스폰(Setup / 부활)과 현재 Player의 Job 안에서만 사용
+		Clock::time_point nextActionTime;
+		uint64_t lastBytes = 0;	// Monitor 구간 계산용
+	};
+
+	void Setup();
+	void Teardown();
+	void SeedBot(SimBot& bot, int botIndex) const;
+	void SpawnPlayer(SimBot& bot);
+	void PostBotAction(SimBot& bot);
+	void RunBotAction(SimBot& bot, Player* player);	// GameThread에서 실행
+	void ChooseDestination(SimBot& bot, const game::Pos& cur, game::Pos& dest, std::mt19937& rng) const;
+	int32_t FindAttackTarget(Player* player, std::mt19937& rng) const;
+	void ChooseSpawnPosition(float& x, float& z, std::mt19937& rng) const;
+	void Report(double seconds, bool final);
+
+	static PacketKind ClassifyPacket(uint32_t packet_id);
+
+private:
+	SimulationConfig config_;
+
+	std::unique_ptr<JobThreadBase> coreThread_;
+	std::vector<std::unique_ptr<GameThread>> gameThreads_;
+	std::vector<std::unique_ptr<GameScene>> scenes_;
+	std::vector<std::unique_ptr<SimBot>> bots_;
+
+	SinkTotals sinkTotals_;
+	std::atomic<uint32_t> nextPlayerId_{1};
+	std::atomic<uint64_t> movesApplied_{0};
+	std::atomic<uint64_t> attacksApplied_{0};
+	std::atomic<uint64_t> respawns_{0};
+
+	// 구간/전체 집계 (Report에서만 접근)
+	uint64_t lastPackets_[PACKET_KIND_COUNT] = {};
+	uint64_t lastMoves_ = 0;
+	uint64_t lastAttacks_ = 0;
+	uint64_t lastSinkNs_ = 0;
+	std::vector<GameThread::FrameStats> totalFrameStats_;
+	double totalSeconds_ = 0.0;
+};
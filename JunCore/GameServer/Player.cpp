@@ -12,7 +12,7 @@ Player::Player(GameScene* scene, User* owner, uint32_t player_id, float x, float
 	m_pMoveComp = AddComponent<MoveComponent>(0.1f);  // 50Hz 기준 초당 5m 이동
 
 	// AttackComponent 추가
-	m_pAttackComp = AddComponent<AttackComponent>();
+	m_pAttackComp = AddComponent<AttackComponent>(this);
 
 	// 이동 이벤트 구독 (RAII - Player 소멸 시 자동 해제)
 	m_moveStartSub = m_pMoveComp->OnMoveStart.Subscribe([this]()
@@ -358,7 +358,8 @@ void Player::BroadcastMoveNotify()
 	notify.mutable_cur_pos()->CopyFrom(GetCurrentPos());
 	notify.mutable_move_pos()->CopyFrom(GetDestPos());
 
-	BroadcastToScene(notify);
+	// 느린 클라이언트에 쌓인 이전 이동 패킷은 최신 것으로 대체
+	BroadcastToSceneCoalesced(notify, MovementCoalesceKey());
 
 	// AOI 진단: GetNearbyObjects가 실제로 몇 명을 찾는지 확인
 	size_t nearby_count = m_pScene ? m_pScene->GetNearbyObjects(this, true).size() : 0;
@@ -376,7 +377,8 @@ void Player::BroadcastMoveStopNotify()
 	notify.set_player_id(player_id_);
 	notify.mutable_position()->CopyFrom(GetCurrentPos());
 
-	BroadcastToScene(notify);
+	// MOVE_NOTIFY와 같은 키 사용 -> 미전송 이동 패킷을 정지 패킷으로 대체 (정지 후 이전 이동이 도착하지 않도록)
+	BroadcastToSceneCoalesced(notify, MovementCoalesceKey());
 
 	LOG_DEBUG("[Player::BroadcastMoveStopNotify] Player (ID: %u) stopped at (%.2f, %.2f, %.2f)",
 		player_id_,
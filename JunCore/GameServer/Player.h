@@ -70,6 +70,25 @@ public:
 		});
 	}
 
+	// 인접 9셀 내 모든 Player에게 브로드캐스트 (자신 포함, 같은 키의 미전송 패킷은 대체)
+	template<typename T>
+	void BroadcastToSceneCoalesced(const T& packet, uint64_t coalesce_key)
+	{
+		if (!m_pScene)
+		{
+			return;
+		}
+
+		m_pScene->ForEachAdjacentObjects(this, true, [&](GameObject* obj)
+		{
+			Player* player = dynamic_cast<Player*>(obj);
+			if (player && player->owner_)
+			{
+				player->owner_->SendCoalescedPacket(packet, coalesce_key);
+			}
+		});
+	}
+
 	// 인접 9셀 내 다른 Player들에게 브로드캐스트 (자신 제외)
 	template<typename T>
 	void BroadcastToOthers(const T& packet)
@@ -121,6 +140,11 @@ private:
 	// ──────────────────────────────────────────────────────
 	void BroadcastMoveNotify();
 	void BroadcastMoveStopNotify();
+	uint64_t MovementCoalesceKey() const
+	{
+		static const uint32_t movement_group = PACKET_ID(game::GC_MOVE_NOTIFY);
+		return MakeCoalesceKey(movement_group, player_id_);
+	}
 
 private:
 	// 공격 사거리
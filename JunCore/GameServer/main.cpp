@@ -1,23 +1,108 @@
-﻿#include <cstdlib>
+﻿#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include "GameServer.h"
+#include "GameSimulation.h"
 #include "../JunCommon/system/CrashDump.h"
 #include "../JunCore/network/IOCPManager.h"
 using namespace std;
 
 static CrashDump dump;
 
-void log(const GameServer& server);
+void log(GameServer& server);
 
-int main()
+namespace
+{
+	// 종료 요청 (Ctrl+C / Ctrl+Break / 콘솔 닫기) -> 메인 루프 탈출 후 Drain
+	std::atomic<bool> g_shutdownRequested{false};
+	std::atomic<bool> g_shutdownComplete{false};
+
+	BOOL WINAPI OnConsoleCtrl(DWORD ctrlType)
+	{
+		g_shutdownRequested.store(true);
+
+		// 닫기/로그오프/시스템 종료는 핸들러가 반환하면 프로세스가 바로 끝나므로 Drain이 끝날 때까지 붙잡음
+		// (OS가 핸들러에 주는 시간은 수 초뿐이므로 롤링 재시작은 Ctrl+C / Ctrl+Break로 요청할 것)
+		if (ctrlType == CTRL_CLOSE_EVENT || ctrlType == CTRL_LOGOFF_EVENT || ctrlType == CTRL_SHUTDOWN_EVENT)
+		{
+			while (!g_shutdownComplete.load())
+			{
+				Sleep(50);
+			}
+		}
+		return TRUE;
+	}
+}
+
+// 헤드리스 시뮬레이션: GameServer --simulate [bots] [--pattern uniform|cluster|border] [--scenes N] [--threads N]
+//                       [--core-threads N] [--seconds N] [--action MS] [--attack PERMILLE] [--no-serialize]
+//                       [--flood JOBS] [--flush-jobs N] [--flush-us N] [--job-stats] [--seed N]
+int RunSimulation(int argc, char* argv[])
+{
+	SimulationConfig config;
+	int i = 2;
+	if (i < argc && argv[i][0] != '-')
+	{
+		config.botCount = atoi(argv[i++]);
+	}
+
+	for (; i < argc; i++)
+	{
+		const bool hasValue = (i + 1 < argc);
+		if (strcmp(argv[i], "--pattern") == 0 && hasValue)
+		{
+			if (!SimulationConfig::ParsePattern(argv[++i], config.pattern))
+			{
+				LOG_WARN("Unknown pattern: %s (uniform|cluster|border)", argv[i]);
+			}
+		}
+		else if (strcmp(argv[i], "--scenes") == 0 && hasValue)		config.sceneCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--threads") == 0 && hasValue)		config.gameThreadCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--core-threads") == 0 && hasValue)	config.coreThreadCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--seconds") == 0 && hasValue)		config.durationSeconds = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--action") == 0 && hasValue)		config.actionIntervalMs = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--attack") == 0 && hasValue)		config.attackPerThousand = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--no-serialize") == 0)			config.serializePackets = false;
+		else if (strcmp(argv[i], "--flood") == 0 && hasValue)		config.floodJobsPerTick = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--flush-jobs") == 0 && hasValue)	config.flushMaxJobs = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--flush-us") == 0 && hasValue)		config.flushMaxUs = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--job-stats") == 0)				config.jobStats = true;
+		else if (strcmp(argv[i], "--seed") == 0 && hasValue)			config.seed = strtoull(argv[++i], nullptr, 10);
+		else
+		{
+			LOG_WARN("Unknown argument: %s", argv[i]);
+		}
+	}
+
+	GameSimulation simulation(config);
+	simulation.Run();
+	return 0;
+}
+
+int main(int argc, char* argv[])
 {
 	try
 	{
+		// 로직 측정에 로그 비용이 섞이지 않도록 ERROR만 출력
+		if (argc >= 2 && strcmp(argv[1], "--simulate") == 0)
+		{
+			LOGGER_INITIALIZE_SYNC(LOG_LEVEL_ERROR);
+			return RunSimulation(argc, argv);
+		}
+
 		// Logger 초기화
 		LOGGER_INITIALIZE_SYNC(LOG_LEVEL_INFO);
 
-		// IOCP Manager 생성 (Worker 스레드 4개)
-		auto iocpManager = IOCPManager::Create().WithWorkerCount(4).WithMonitoring(true).Build();
+		// 멀티 소켓 장비: IOCP Worker는 NUMA 0, 게임 로직 스레드는 NUMA 1 코어에 하나씩 고정
+		// (GameThread 프레임이 코어를 옮겨다니며 L2를 잃지 않도록)
+		const bool isMultiSocket = ThreadPlacement::GetNumaNodeCount() > 1;
+		const ThreadPlacement networkPlacement = isMultiSocket ? ThreadPlacement::NumaNode(0) : ThreadPlacement::Any();
+		const ThreadPlacement logicPlacement = isMultiSocket ? ThreadPlacement::NumaNode(1, true) : ThreadPlacement::Any();
+
+		// IOCP Manager 생성 (Worker 스레드 4개로 시작, 부하에 따라 2~8개 조정)
+		auto iocpManager = IOCPManager::Create().WithWorkerCount(4).WithAdaptiveWorkers(2, 8).WithWorkerPlacement(networkPlacement).WithMonitoring(true).Build();
 
 		if (!iocpManager->IsValid())
 		{
@@ -27,11 +112,19 @@ int main()
 
 		// GameServer 생성 (GameThread 2개)
 		GameServer gameServer(std::shared_ptr<IOCPManager>(std::move(iocpManager)), 2);
+		gameServer.SetGameThreadPlacement(logicPlacement);
+		gameServer.SetCoreThreadPlacement(isMultiSocket ? ThreadPlacement::NumaNode(1) : ThreadPlacement::Any());
 		gameServer.Initialize();
 
 		LOG_INFO("Server will start in 3 seconds");
 		Sleep(3000);
 
+		// --capture <file> : 수신 패킷 캡처 (StressClient --replay로 재생)
+		if (argc >= 3 && strcmp(argv[1], "--capture") == 0)
+		{
+			gameServer.StartPacketCapture(argv[2]);
+		}
+
 		if (gameServer.StartServer("0.0.0.0"/*IP*/, 8888/*Port*/, 1000 /*Max session*/))
 		{
 			LOG_INFO("GameServer started on port 8888");
@@ -44,8 +137,14 @@ int main()
 
 		bool isProfileMode = false;
 
-		// 메인 루프: 1초마다 통계 출력
-		while(true)
+		// 프로파일 모드에서만 Job 계측 (PostJob / Job마다 시계 조회 비용)
+		JobStats::SetEnabled(isProfileMode);
+
+		// 메인 루프: 1초마다 통계 출력, 종료 요청 시 빠져나와 Drain
+		SetConsoleCtrlHandler(OnConsoleCtrl, TRUE);
+		LOG_INFO("Press Ctrl+C (or Ctrl+Break) to drain sessions and stop");
+
+		while (!g_shutdownRequested.load())
 		{
 			Sleep(1000);
 
@@ -56,6 +155,14 @@ int main()
 			}
 		}
 
+		// 신규 연결 차단 후 종료 알림 -> 송신 큐 flush (최대 5초) -> 정지
+		LOG_INFO("Shutdown requested, draining sessions");
+		game::GC_ERROR_NOTIFY goodbye;
+		goodbye.set_error_code(game::SERVER_SHUTDOWN);
+		goodbye.set_error_message("Server is shutting down");
+		gameServer.DrainServer(goodbye, 5000);
+		gameServer.StopPacketCapture();
+
 		gameServer.StopServer();
 	}
 	catch (const std::exception& e)
@@ -66,10 +173,15 @@ int main()
 	{
 		LOG_ERROR("Unknown exception caught in main");
 	}
+
+	g_shutdownComplete.store(true);
 }
 
-void log(const GameServer& server)
+void log(GameServer& server)
 {
+	const auto pool = server.GetWorkerPoolStats();
+	JobStatsReport jobs = server.TakeJobStats();
+
 	printf("=== GameServer 세션 통계 ===\n"
 		"현재 접속중인 세션 수: %u\n"
 		"누적 연결된 세션 수: %u\n"
@@ -77,10 +189,43 @@ void log(const GameServer& server)
 		"=== 네트워크 통계 (10초) ===\n"
 		"수신 속도: %.2f KB/s\n"
 		"송신 속도: %.2f KB/s\n"
+		"=== IOCP Worker 풀 ===\n"
+		"활성/park Worker: %d / %d (범위 %d~%d)\n"
+		"사용률: %.1f%%, 포화: %.1f%%\n"
+		"증설/축소 횟수: %llu / %llu\n"
 		"========================\n",
 		server.GetCurrentSessions(),
 		server.GetTotalConnected(),
 		server.GetTotalDisconnected(),
 		server.GetRecvBytesPerSecond(10) / 1024.0,
-		server.GetSendBytesPerSecond(10) / 1024.0);
+		server.GetSendBytesPerSecond(10) / 1024.0,
+		pool.activeWorkers, pool.parkedWorkers, pool.minWorkers, pool.maxWorkers,
+		pool.utilization * 100.0, pool.saturation * 100.0,
+		pool.scaleUpCount, pool.scaleDownCount);
+
+	// Job 통계: 대기 시간 p99 기준 상위 타입 (밀리는 매니저 / 느린 플레이어 추적용)
+	printf("=== Job 통계 (1초) ===\n"
+		"코어 스레드: 대기 p99 %llu us, 실행 p99 %llu us, Flush당 Job p99 %llu, 큐 깊이 max %llu\n",
+		jobs.coreThread.waitUs.ValueAtPercentile(99.0), jobs.coreThread.runUs.ValueAtPercentile(99.0),
+		jobs.coreThread.jobsPerFlush.ValueAtPercentile(99.0), jobs.coreThread.queueDepth.max);
+	for (size_t i = 0; i < jobs.gameThreads.size(); ++i)
+	{
+		const auto& thread = jobs.gameThreads[i];
+		printf("GameThread %zu: 대기 p99 %llu us, 실행 p99 %llu us, Flush당 Job p99 %llu, 큐 깊이 max %llu\n",
+			i, thread.waitUs.ValueAtPercentile(99.0), thread.runUs.ValueAtPercentile(99.0),
+			thread.jobsPerFlush.ValueAtPercentile(99.0), thread.queueDepth.max);
+	}
+
+	constexpr size_t TOP_TYPES = 5;
+	std::sort(jobs.types.begin(), jobs.types.end(), [](const JobStats::TypeSnapshot& a, const JobStats::TypeSnapshot& b) {
+		return a.stats.waitUs.ValueAtPercentile(99.0) > b.stats.waitUs.ValueAtPercentile(99.0);
+	});
+	for (size_t i = 0; i < jobs.types.size() && i < TOP_TYPES; ++i)
+	{
+		const auto& type = jobs.types[i];
+		printf("%s: Job %llu, 대기 p99 %llu us, 실행 p99 %llu us, 큐 깊이 max %llu\n",
+			type.typeName.c_str(), type.stats.runUs.count, type.stats.waitUs.ValueAtPercentile(99.0),
+			type.stats.runUs.ValueAtPercentile(99.0), type.stats.queueDepth.max);
+	}
+	printf("========================\n");
 }
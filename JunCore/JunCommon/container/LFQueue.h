@@ -2,6 +2,8 @@
 #include <Windows.h>
 #include "../pool/LFObjectPool.h"
 #include "../core/base.h"
+#include <type_traits>
+#include <utility>
 
 template <typename T>
 class LFQueue {
@@ -60,7 +62,7 @@ LFQueue<T>::~LFQueue() {
 template<typename T>
 void LFQueue<T>::Enqueue(T data) {
 	Node* enqueNode = nodePool.Alloc();
-	enqueNode->data = data;
+	enqueNode->data = std::move(data);
 
 	for (;;) {
 		DWORD64 copyTailStamp = tailStamp;
@@ -123,14 +125,26 @@ bool LFQueue<T>::Dequeue(T* data) {
 		if (headNext == nullptr)
 			continue;
 
-		T dqData = headNext->data;
-
-		// Dequeue �õ�
 		DWORD64 newHeadStamp = ((copyHeadStamp + kStampCount) & kStampMask) | (DWORD64)headNext;
-		if (InterlockedCompareExchange64((LONG64*)&headStamp, (LONG64)newHeadStamp, (LONG64)copyHeadStamp) == (DWORD64)copyHeadStamp) {
-			*data = dqData;
-			nodePool.Free(headClean);
-			return true;
+
+		if constexpr (std::is_copy_constructible_v<T>) {
+			// 복사 가능한 T: CAS 전에 복사 (경쟁 소비자가 이긴 뒤 노드를 해제할 수 있음)
+			T dqData = headNext->data;
+
+			if (InterlockedCompareExchange64((LONG64*)&headStamp, (LONG64)newHeadStamp, (LONG64)copyHeadStamp) == (DWORD64)copyHeadStamp) {
+				*data = std::move(dqData);
+				nodePool.Free(headClean);
+				return true;
+			}
+		}
+		else {
+			// 이동 전용 T (Job 등): 단일 소비자 전용, CAS 성공 후 이동
+			// 소비자가 하나면 headNext(새 dummy)를 해제할 수 있는 스레드가 자신뿐이므로 안전
+			if (InterlockedCompareExchange64((LONG64*)&headStamp, (LONG64)newHeadStamp, (LONG64)copyHeadStamp) == (DWORD64)copyHeadStamp) {
+				*data = std::move(headNext->data);
+				nodePool.Free(headClean);
+				return true;
+			}
 		}
 	}
 }
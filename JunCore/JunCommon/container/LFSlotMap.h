@@ -0,0 +1,189 @@
+﻿#pragma once
+#include <Windows.h>
+#include "LFStack.h"
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+
+//------------------------------
+// LFSlotMap - 세대(generation) 핸들 -> T* 조회 맵 (조회는 아무 스레드에서 lock-free)
+//
+// - 핸들 = (세대 << 32) | 슬롯 인덱스, 0은 무효 핸들 (세대는 1부터)
+// - 슬롯은 PAGE_SIZE 단위 페이지로 늘어나고 해제되지 않음 (조회 중 재할당 없음)
+// - 슬롯 상태 = (세대 << 32) | 핀 수
+//   Visit: 세대가 같을 때만 CAS로 핀 +1 -> 콜백 -> 핀 -1
+//   Remove: 세대 +1 (이후 옛 핸들 조회 실패) -> 핀이 0이 될 때까지 대기 -> 인덱스 반납
+//   Remove가 끝나면 옛 핸들로 T*를 쥔 스레드가 없으므로 호출자가 T를 해제해도 안전
+// - Allocate / Remove는 드묾 (오브젝트 생성 / 삭제), 빈 인덱스는 LFStack으로 재사용
+//------------------------------
+template <typename T>
+class LFSlotMap {
+public:
+	static constexpr uint32_t PAGE_SHIFT = 12;
+	static constexpr uint32_t PAGE_SIZE = 1u << PAGE_SHIFT;
+	static constexpr uint32_t MAX_PAGES = 1024;				// 최대 4M 슬롯
+
+public:
+	LFSlotMap() = default;
+
+	~LFSlotMap() {
+		for (auto& page : pages_) {
+			delete[] page.load();
+		}
+	}
+
+	LFSlotMap(const LFSlotMap&) = delete;
+	LFSlotMap& operator=(const LFSlotMap&) = delete;
+
+private:
+	struct Slot {
+		std::atomic<uint64_t> state{ uint64_t{ 1 } << 32 };	// 세대 1, 핀 0
+		std::atomic<T*> object{ nullptr };
+	};
+
+	std::atomic<Slot*> pages_[MAX_PAGES] = {};
+	alignas(64) std::atomic<uint32_t> nextIndex_{ 0 };
+	alignas(64) std::atomic<uint32_t> count_{ 0 };
+	LFStack<uint32_t> freeIndices_;
+
+public:
+	//------------------------------
+	// 슬롯 예약 (T*는 Publish 전까지 nullptr이라 조회 실패)
+	//------------------------------
+	uint64_t Allocate() {
+		uint32_t index;
+		if (!freeIndices_.Pop(&index)) {
+			index = nextIndex_.fetch_add(1);
+			if (index >= MAX_PAGES * PAGE_SIZE) {
+				throw std::runtime_error("LFSlotMap: out of slots");
+			}
+			EnsurePage(index >> PAGE_SHIFT);
+		}
+
+		count_.fetch_add(1, std::memory_order_relaxed);
+		const uint32_t generation = static_cast<uint32_t>(GetSlot(index).state.load() >> 32);
+		return MakeHandle(generation, index);
+	}
+
+	//------------------------------
+	// 조회 대상 등록 / 교체 (옛 핸들이면 false)
+	//------------------------------
+	bool Publish(uint64_t handle, T* object) {
+		Slot* slot = FindSlot(handle);
+		if (slot == nullptr || GenerationOf(slot->state.load()) != GenerationOf(handle)) {
+			return false;
+		}
+		slot->object.store(object, std::memory_order_release);
+		return true;
+	}
+
+	//------------------------------
+	// 슬롯 해제 (옛 핸들이면 false, 여러 번 불러도 안전)
+	// 진행 중인 Visit이 끝날 때까지 대기하므로 Visit 콜백 안에서 같은 핸들 Remove 금지
+	//------------------------------
+	bool Remove(uint64_t handle) {
+		Slot* slot = FindSlot(handle);
+		if (slot == nullptr) {
+			return false;
+		}
+
+		uint64_t state = slot->state.load();
+		for (;;) {
+			if (GenerationOf(state) != GenerationOf(handle)) {
+				return false;
+			}
+
+			// 세대 0은 무효 핸들용이므로 건너뜀
+			uint32_t nextGeneration = GenerationOf(handle) + 1;
+			if (nextGeneration == 0) {
+				nextGeneration = 1;
+			}
+
+			const uint64_t next = (static_cast<uint64_t>(nextGeneration) << 32) | (state & PIN_MASK);
+			if (slot->state.compare_exchange_weak(state, next)) {
+				break;
+			}
+		}
+
+		slot->object.store(nullptr, std::memory_order_release);
+
+		while ((slot->state.load(std::memory_order_acquire) & PIN_MASK) != 0) {
+			YieldProcessor();
+		}
+
+		count_.fetch_sub(1, std::memory_order_relaxed);
+		freeIndices_.Push(IndexOf(handle));
+		return true;
+	}
+
+	//------------------------------
+	// 핸들이 살아있으면 핀을 쥔 채 fn(T*) 호출 (아무 스레드)
+	// fn 동안 Remove가 대기하므로 짧게 (PostJob 정도)
+	//------------------------------
+	template <typename F>
+	bool Visit(uint64_t handle, F&& fn) {
+		Slot* slot = FindSlot(handle);
+		if (slot == nullptr) {
+			return false;
+		}
+
+		uint64_t state = slot->state.load(std::memory_order_acquire);
+		do {
+			if (GenerationOf(state) != GenerationOf(handle)) {
+				return false;
+			}
+		} while (!slot->state.compare_exchange_weak(state, state + 1, std::memory_order_acquire));
+
+		struct Unpin {
+			Slot* slot;
+			~Unpin() { slot->state.fetch_sub(1, std::memory_order_release); }
+		} unpin{ slot };
+
+		T* object = slot->object.load(std::memory_order_acquire);
+		if (object == nullptr) {
+			return false;
+		}
+
+		fn(object);
+		return true;
+	}
+
+	uint32_t GetCount() const { return count_.load(std::memory_order_relaxed); }
+
+private:
+	static constexpr uint64_t PIN_MASK = 0xFFFFFFFFull;
+
+	static uint64_t MakeHandle(uint32_t generation, uint32_t index) { return (static_cast<uint64_t>(generation) << 32) | index; }
+	static uint32_t GenerationOf(uint64_t value) { return static_cast<uint32_t>(value >> 32); }
+	static uint32_t IndexOf(uint64_t handle) { return static_cast<uint32_t>(handle); }
+
+	Slot& GetSlot(uint32_t index) {
+		return pages_[index >> PAGE_SHIFT].load(std::memory_order_acquire)[index & (PAGE_SIZE - 1)];
+	}
+
+	Slot* FindSlot(uint64_t handle) {
+		const uint32_t index = IndexOf(handle);
+		if (GenerationOf(handle) == 0 || (index >> PAGE_SHIFT) >= MAX_PAGES) {
+			return nullptr;
+		}
+
+		Slot* page = pages_[index >> PAGE_SHIFT].load(std::memory_order_acquire);
+		if (page == nullptr) {
+			return nullptr;
+		}
+		return &page[index & (PAGE_SIZE - 1)];
+	}
+
+	void EnsurePage(uint32_t pageIndex) {
+		if (pages_[pageIndex].load(std::memory_order_acquire) != nullptr) {
+			return;
+		}
+
+		// 같은 페이지를 여러 스레드가 동시에 만들면 CAS에 진 쪽이 버림
+		Slot* fresh = new Slot[PAGE_SIZE];
+		Slot* expected = nullptr;
+		if (!pages_[pageIndex].compare_exchange_strong(expected, fresh, std::memory_order_acq_rel)) {
+			delete[] fresh;
+		}
+	}
+};
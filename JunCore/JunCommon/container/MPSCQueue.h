@@ -0,0 +1,107 @@
+﻿#pragma once
+#include <Windows.h>
+#include <atomic>
+#include <type_traits>
+
+//------------------------------
+// MPSCQueue - 침습형(intrusive) 다중 생산자 / 단일 소비자 큐 (Vyukov)
+//
+// - 원소가 MPSCQueueNode를 상속해 링크를 직접 가짐 (노드 풀 / 할당 없음)
+// - Enqueue: XCHG 1회 + store 1회 (wait-free, 카운터 없음)
+// - Dequeue: 소비자 전용 tail만 갱신하므로 원자적 RMW 없이 연결된 노드를 연달아 꺼냄
+//   마지막 노드를 꺼낼 때만 stub을 다시 넣기 위해 XCHG 1회
+// - 소비자는 한 번에 한 스레드만 (JobObject::Flush, JobThread 루프)
+// - 원소는 Dequeue로 반환된 뒤에만 해제 가능 (큐가 더는 링크를 건드리지 않음)
+//------------------------------
+struct MPSCQueueNode
+{
+	std::atomic<MPSCQueueNode*> mpscNext{nullptr};
+};
+
+template <typename T>
+class MPSCQueue {
+public:
+	MPSCQueue() : head_(&stub_), tail_(&stub_) {}
+
+	MPSCQueue(const MPSCQueue&) = delete;
+	MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+private:
+	alignas(64) std::atomic<MPSCQueueNode*> head_;	// 생산자 측 (마지막으로 들어온 노드)
+	alignas(64) MPSCQueueNode* tail_;				// 소비자 전용 (다음에 꺼낼 노드)
+	MPSCQueueNode stub_;
+
+public:
+	//------------------------------
+	// 생산자 (아무 스레드)
+	//------------------------------
+	void Enqueue(T* item) {
+		static_assert(std::is_base_of_v<MPSCQueueNode, T>, "MPSCQueue: T must derive from MPSCQueueNode");
+		Push(item);
+	}
+
+	//------------------------------
+	// 소비자 (단일 스레드), 비었으면 nullptr
+	//------------------------------
+	T* Dequeue() {
+		MPSCQueueNode* tail = tail_;
+		MPSCQueueNode* next = tail->mpscNext.load(std::memory_order_acquire);
+
+		// stub 건너뛰기
+		if (tail == &stub_) {
+			if (next == nullptr) {
+				return nullptr;
+			}
+			tail_ = next;
+			tail = next;
+			next = next->mpscNext.load(std::memory_order_acquire);
+		}
+
+		if (next != nullptr) {
+			tail_ = next;
+			return static_cast<T*>(tail);
+		}
+
+		// tail이 마지막 노드: stub을 뒤에 붙여야 tail을 떼어낼 수 있음
+		// head != tail이면 생산자가 XCHG 후 링크를 아직 안 건 상태이므로 링크될 때까지 대기 (수 명령어 구간)
+		// stub을 붙인 경우에도 그 사이 끼어든 생산자의 링크를 기다림
+		if (tail == head_.load()) {
+			Push(&stub_);
+		}
+
+		while ((next = tail->mpscNext.load(std::memory_order_acquire)) == nullptr) {
+			YieldProcessor();
+		}
+
+		tail_ = next;
+		return static_cast<T*>(tail);
+	}
+
+	//------------------------------
+	// 남은 노드가 있는지 (소비자 전용)
+	// head만으로는 부족함: 마지막 노드를 꺼내며 stub을 붙이는 사이 생산자가 끼어들면
+	// tail_=B, B->next=stub, head_=stub 상태가 되어 head는 stub인데 B가 아직 남아 있음
+	// 생산자가 XCHG 후 링크 중인 경우도 남은 것으로 봄
+	//------------------------------
+	bool HasPending() const {
+		return tail_ != &stub_ ||
+			stub_.mpscNext.load(std::memory_order_acquire) != nullptr ||
+			head_.load() != &stub_;
+	}
+
+	//------------------------------
+	// 비었는지 확인 (아무 스레드)
+	// head만 보므로 소비자가 HasPending() == false를 확인한 뒤의 재확인에만 유효
+	// (그 상태에서 head를 stub에서 바꾸는 것은 이후 Enqueue뿐, 다시 stub으로 되돌리는 것은 소비자의 Dequeue뿐)
+	//------------------------------
+	bool IsEmpty() const {
+		return head_.load() == &stub_;
+	}
+
+private:
+	void Push(MPSCQueueNode* node) {
+		node->mpscNext.store(nullptr, std::memory_order_relaxed);
+		MPSCQueueNode* prev = head_.exchange(node);
+		prev->mpscNext.store(node, std::memory_order_release);
+	}
+};
@@ -0,0 +1,206 @@
+#include "X25519.h"
+#include <openssl/crypto.h>
+#include <stdexcept>
+
+X25519::X25519() : keypair_(nullptr), peer_public_(nullptr)
+{
+}
+
+X25519::~X25519()
+{
+    if (keypair_) {
+        EVP_PKEY_free(keypair_);
+        keypair_ = nullptr;
+    }
+    if (peer_public_) {
+        EVP_PKEY_free(peer_public_);
+        peer_public_ = nullptr;
+    }
+}
+
+bool X25519::GenerateKeyPair()
+{
+    // 기존 키가 있으면 해제
+    if (keypair_) {
+        EVP_PKEY_free(keypair_);
+        keypair_ = nullptr;
+    }
+
+    // X25519 키 생성 컨텍스트 생성
+    EVP_PKEY_CTX* ctx = EVP_PKEY_CTX_new_id(EVP_PKEY_X25519, nullptr);
+    if (!ctx) {
+        return false;
+    }
+
+    if (EVP_PKEY_keygen_init(ctx) <= 0) {
+        EVP_PKEY_CTX_free(ctx);
+        return false;
+    }
+
+    // 키 쌍 생성 (RSA와 달리 소수 탐색이 없으므로 즉시 완료)
+    if (EVP_PKEY_keygen(ctx, &keypair_) <= 0) {
+        keypair_ = nullptr;
+        EVP_PKEY_CTX_free(ctx);
+        return false;
+    }
+
+    EVP_PKEY_CTX_free(ctx);
+    return (keypair_ != nullptr);
+}
+
+std::vector<unsigned char> X25519::ExportPublicKey() const
+{
+    if (!keypair_) {
+        throw std::runtime_error("No key pair available for export");
+    }
+
+    std::vector<unsigned char> result(X25519Constants::KEY_SIZE_BYTES);
+    size_t len = result.size();
+
+    if (EVP_PKEY_get_raw_public_key(keypair_, result.data(), &len) != 1 ||
+        len != X25519Constants::KEY_SIZE_BYTES) {
+        throw std::runtime_error("Failed to export X25519 public key");
+    }
+
+    return result;
+}
+
+bool X25519::ImportPeerPublicKey(const std::vector<unsigned char>& publicKeyData)
+{
+    // 기존 공개키가 있으면 해제
+    if (peer_public_) {
+        EVP_PKEY_free(peer_public_);
+        peer_public_ = nullptr;
+    }
+
+    if (publicKeyData.size() != X25519Constants::KEY_SIZE_BYTES) {
+        return false;
+    }
+
+    peer_public_ = EVP_PKEY_new_raw_public_key(EVP_PKEY_X25519, nullptr,
+                                               publicKeyData.data(), publicKeyData.size());
+
+    return (peer_public_ != nullptr);
+}
+
+bool X25519::ComputeSharedSecret(std::vector<unsigned char>& secret) const
+{
+    if (!keypair_ || !peer_public_) {
+        return false;
+    }
+
+    EVP_PKEY_CTX* ctx = EVP_PKEY_CTX_new(keypair_, nullptr);
+    if (!ctx) {
+        return false;
+    }
+
+    if (EVP_PKEY_derive_init(ctx) <= 0 ||
+        EVP_PKEY_derive_set_peer(ctx, peer_public_) <= 0) {
+        EVP_PKEY_CTX_free(ctx);
+        return false;
+    }
+
+    secret.resize(X25519Constants::SHARED_SECRET_SIZE);
+    size_t secret_len = secret.size();
+
+    // 상대 공개키가 저위수(small-order) 점이면 all-zero 결과로 실패 처리됨
+    if (EVP_PKEY_derive(ctx, secret.data(), &secret_len) <= 0 ||
+        secret_len != X25519Constants::SHARED_SECRET_SIZE) {
+        OPENSSL_cleanse(secret.data(), secret.size());
+        secret.clear();
+        EVP_PKEY_CTX_free(ctx);
+        return false;
+    }
+
+    EVP_PKEY_CTX_free(ctx);
+    return true;
+}
+
+bool X25519::DeriveKeyMaterial(const std::vector<unsigned char>& salt,
+                               const std::vector<unsigned char>& info,
+                               size_t length,
+                               std::vector<unsigned char>& output) const
+{
+    if (length == 0) {
+        return false;
+    }
+
+    // 1. ECDH 공유 비밀 계산
+    std::vector<unsigned char> secret;
+    if (!ComputeSharedSecret(secret)) {
+        return false;
+    }
+
+    // 2. HKDF-SHA256 (extract + expand)
+    EVP_PKEY_CTX* ctx = EVP_PKEY_CTX_new_id(EVP_PKEY_HKDF, nullptr);
+    if (!ctx) {
+        OPENSSL_cleanse(secret.data(), secret.size());
+        return false;
+    }
+
+    bool success =
+        EVP_PKEY_derive_init(ctx) > 0 &&
+        EVP_PKEY_CTX_set_hkdf_md(ctx, EVP_sha256()) > 0 &&
+        EVP_PKEY_CTX_set1_hkdf_key(ctx, secret.data(), static_cast<int>(secret.size())) > 0 &&
+        (salt.empty() || EVP_PKEY_CTX_set1_hkdf_salt(ctx, salt.data(), static_cast<int>(salt.size())) > 0) &&
+        (info.empty() || EVP_PKEY_CTX_add1_hkdf_info(ctx, info.data(), static_cast<int>(info.size())) > 0);
+
+    if (success) {
+        output.resize(length);
+        size_t out_len = length;
+        success = EVP_PKEY_derive(ctx, output.data(), &out_len) > 0 && out_len == length;
+    }
+
+    if (!success) {
+        output.clear();
+    }
+
+    // 공유 비밀은 유도 후 즉시 폐기
+    OPENSSL_cleanse(secret.data(), secret.size());
+    EVP_PKEY_CTX_free(ctx);
+
+    return success;
+}
+
+bool X25519::DeriveAES128SessionKey(const std::vector<unsigned char>& salt,
+                                    std::vector<unsigned char>& aesKey,
+                                    std::vector<unsigned char>& aesIV) const
+{
+    const std::vector<unsigned char> info(
+        X25519Constants::SESSION_KEY_INFO,
+        X25519Constants::SESSION_KEY_INFO + sizeof(X25519Constants::SESSION_KEY_INFO) - 1);
+
+    // 키(16) + IV(16)를 한 번에 유도 후 분리
+    std::vector<unsigned char> material;
+    if (!DeriveKeyMaterial(salt, info, X25519Constants::AES_KEY_SIZE + X25519Constants::AES_IV_SIZE, material)) {
+        return false;
+    }
+
+    aesKey.assign(material.begin(), material.begin() + X25519Constants::AES_KEY_SIZE);
+    aesIV.assign(material.begin() + X25519Constants::AES_KEY_SIZE, material.end());
+
+    OPENSSL_cleanse(material.data(), material.size());
+    return true;
+}
+
+bool X25519::HasKeyPair() const
+{
+    return (keypair_ != nullptr);
+}
+
+bool X25519::HasPeerPublicKey() const
+{
+    return (peer_public_ != nullptr);
+}
+
+std::string X25519::GetLastError()
+{
+    unsigned long error_code = ERR_get_error();
+    if (error_code == 0) {
+        return "No error";
+    }
+
+    char error_buf[256];
+    ERR_error_string_n(error_code, error_buf, sizeof(error_buf));
+    return std::string(error_buf);
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <openssl/evp.h>
+#include <openssl/kdf.h>
+#include <openssl/err.h>
+
+/**
+ * @brief X25519 ECDH 키 교환 클래스
+ *
+ * - RSA2048 키 교환의 경량 대체 (키 생성/합의 모두 수십 us 수준)
+ * - 공개키는 32바이트 raw 형식 (DER 인코딩 없음)
+ * - 공유 비밀은 직접 사용하지 않고 HKDF-SHA256으로 세션키를 유도
+ * - OpenSSL 기반 구현
+ */
+class X25519
+{
+public:
+    X25519();
+    ~X25519();
+
+    // 복사/이동 금지 (키는 고유해야 함)
+    X25519(const X25519&) = delete;
+    X25519& operator=(const X25519&) = delete;
+    X25519(X25519&&) = delete;
+    X25519& operator=(X25519&&) = delete;
+
+public:
+    /**
+     * @brief X25519 키 쌍 생성
+     * @return 성공 시 true, 실패 시 false
+     * @note 세션(로그인)마다 새로 생성하는 임시키(ephemeral) 용도
+     */
+    bool GenerateKeyPair();
+
+    /**
+     * @brief 공개키를 바이너리 형태로 내보내기
+     * @return 공개키 바이너리 데이터 (raw 32바이트)
+     * @throws std::runtime_error 키가 없거나 내보내기 실패 시
+     */
+    std::vector<unsigned char> ExportPublicKey() const;
+
+    /**
+     * @brief 상대방 공개키 가져오기
+     * @param publicKeyData 상대방 공개키 (raw 32바이트)
+     * @return 성공 시 true, 실패 시 false
+     */
+    bool ImportPeerPublicKey(const std::vector<unsigned char>& publicKeyData);
+
+    /**
+     * @brief ECDH + HKDF-SHA256으로 키 재료 유도
+     * @param salt HKDF salt (양측이 동일해야 함, 비어있어도 됨)
+     * @param info HKDF info (용도 구분 문자열, 양측이 동일해야 함)
+     * @param length 유도할 바이트 수
+     * @param output 유도된 키 재료 (출력)
+     * @return 성공 시 true, 실패 시 false
+     * @note 자신의 키 쌍과 상대방 공개키가 모두 있어야 함
+     */
+    bool DeriveKeyMaterial(const std::vector<unsigned char>& salt,
+                           const std::vector<unsigned char>& info,
+                           size_t length,
+                           std::vector<unsigned char>& output) const;
+
+    /**
+     * @brief AES-128 세션키/IV 유도 (DeriveKeyMaterial 래퍼)
+     * @param salt HKDF salt (양측이 동일해야 함)
+     * @param aesKey AES-128 키 (출력, 16바이트)
+     * @param aesIV AES IV (출력, 16바이트)
+     * @return 성공 시 true, 실패 시 false
+     * @note RSA 경로의 AESKeyDelivery와 동일한 결과물(키+IV)을 전송 없이 양측에서 계산
+     */
+    bool DeriveAES128SessionKey(const std::vector<unsigned char>& salt,
+                                std::vector<unsigned char>& aesKey,
+                                std::vector<unsigned char>& aesIV) const;
+
+    /**
+     * @brief 키 쌍이 유효한지 확인
+     * @return 개인키와 공개키 모두 있으면 true
+     */
+    bool HasKeyPair() const;
+
+    /**
+     * @brief 상대방 공개키가 있는지 확인
+     * @return 상대방 공개키가 있으면 true
+     */
+    bool HasPeerPublicKey() const;
+
+    /**
+     * @brief OpenSSL 에러 메시지 가져오기
+     * @return 최근 OpenSSL 에러 문자열
+     */
+    static std::string GetLastError();
+
+private:
+    EVP_PKEY* keypair_;     // 자신의 키 쌍 (개인키 + 공개키)
+    EVP_PKEY* peer_public_; // 상대방의 공개키
+
+    // ECDH 공유 비밀 계산 (내부용)
+    bool ComputeSharedSecret(std::vector<unsigned char>& secret) const;
+};
+
+// X25519 키 교환 상수
+namespace X25519Constants {
+    constexpr int KEY_SIZE_BYTES = 32;                     // 공개키/개인키 크기
+    constexpr int SHARED_SECRET_SIZE = 32;                 // ECDH 공유 비밀 크기
+    constexpr int AES_KEY_SIZE = 16;                       // 유도할 AES-128 키 크기
+    constexpr int AES_IV_SIZE = 16;                        // 유도할 AES IV 크기
+    constexpr char SESSION_KEY_INFO[] = "JunCore AES128 session key";  // HKDF info (용도 구분)
+}
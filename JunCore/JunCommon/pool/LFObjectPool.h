@@ -3,6 +3,7 @@
 #include <Windows.h>
 #include <stdarg.h>
 #include <memory>
+#include <new>
 #include <BaseTsd.h>
 
 template <typename T>
@@ -21,7 +22,8 @@ private:
 	};
 
 public:
-	LFObjectPool(int node_num = 0, bool use_ctor = false);
+	// numa_node >= 0 이면 선할당 노드를 해당 NUMA 노드 메모리에서 할당 (이후 증설분은 new, 할당 스레드의 노드를 따름)
+	LFObjectPool(int node_num = 0, bool use_ctor = false, int numa_node = -1);
 	~LFObjectPool();
 
 private:
@@ -36,6 +38,15 @@ private:
 	alignas(64) int capacity__;
 	alignas(64) int use_count_;
 
+	// NUMA 로컬 선할당 영역
+	char* numa_slab_ = nullptr;
+	size_t numa_slab_size_ = 0;
+
+private:
+	bool IsSlabNode(const Node* node) const {
+		return numa_slab_ != nullptr && (const char*)node >= numa_slab_ && (const char*)node < numa_slab_ + numa_slab_size_;
+	}
+
 public:
 	T* Alloc();
 	void Free(T* object);
@@ -53,7 +64,7 @@ public:
 //------------------------------
 
 template<typename T>
-LFObjectPool<T>::LFObjectPool(int node_num, bool use_ctor) : integrity_((ULONG_PTR)this), use_ctor_(use_ctor), top_stamp_(NULL), capacity__(node_num), use_count_(0) {
+LFObjectPool<T>::LFObjectPool(int node_num, bool use_ctor, int numa_node) : integrity_((ULONG_PTR)this), use_ctor_(use_ctor), top_stamp_(NULL), capacity__(node_num), use_count_(0) {
 	// Stamp 사용 가능 주소 확인
 	SYSTEM_INFO sysInfo;
 	GetSystemInfo(&sysInfo);
@@ -64,9 +75,17 @@ LFObjectPool<T>::LFObjectPool(int node_num, bool use_ctor) : integrity_((ULONG_P
 	Node tmpNode((ULONG_PTR)this);
 	object_offset_ = static_cast<int>((ULONG_PTR)(&tmpNode.object) - (ULONG_PTR)&tmpNode);
 
+	// NUMA 노드 지정 시 선할당 영역 확보 (실패 시 일반 new로 대체)
+	if (0 < node_num && 0 <= numa_node) {
+		numa_slab_size_ = sizeof(Node) * node_num;
+		numa_slab_ = (char*)VirtualAllocExNuma(GetCurrentProcess(), nullptr, numa_slab_size_, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, (DWORD)numa_node);
+		if (numa_slab_ == nullptr)
+			numa_slab_size_ = 0;
+	}
+
 	// 노드들을 미리 생성 및 연결
 	for (int i = 0; i < node_num; i++) {
-		Node* newNode = new Node((ULONG_PTR)this);
+		Node* newNode = numa_slab_ ? new (numa_slab_ + sizeof(Node) * i) Node((ULONG_PTR)this) : new Node((ULONG_PTR)this);
 		newNode->next = (Node*)top_stamp_;
 		top_stamp_ = (ULONG_PTR)newNode;
 	}
@@ -79,8 +98,14 @@ LFObjectPool<T>::~LFObjectPool() {
 	for (; top != nullptr;) {
 		Node* deleteNode = top;
 		top = top->next;
-		delete deleteNode;
+		if (IsSlabNode(deleteNode))
+			deleteNode->~Node();
+		else
+			delete deleteNode;
 	}
+
+	if (numa_slab_)
+		VirtualFree(numa_slab_, 0, MEM_RELEASE);
 }
 
 // 메모리 할당은 POP과 같음
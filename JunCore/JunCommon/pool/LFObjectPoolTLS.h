@@ -1,5 +1,7 @@
 #pragma once
 #include "LFObjectPool.h"
+#include "../system/ThreadPlacement.h"
+#include <atomic>
 
 #define CHUNCK_SIZE 500
 #define USE_COUNT	0		// 0 : ûũ ���� ī��Ʈ, 1 : ���� ���� ī��Ʈ 
@@ -7,15 +9,20 @@
 template <typename T>
 class LFObjectPoolTLS {
 public:
-	LFObjectPoolTLS(bool use_ctor = false) : use_ctor_(use_ctor), tls_index_(TlsAlloc()) {};
-	~LFObjectPoolTLS() {}
+	LFObjectPoolTLS(bool use_ctor = false) : use_ctor_(use_ctor), tls_index_(TlsAlloc()), use_numa_(ThreadPlacement::GetNumaNodeCount() > 1) {};
+	~LFObjectPoolTLS() {
+		for (auto& numa_pool : numa_chunk_pools_) {
+			delete numa_pool.load();
+		}
+	}
 
 private:
 	struct Chunk;
 	struct ChunkData {
 	public:
-		Chunk* my_chunk_;
+		// object를 첫 멤버로 두어 T의 정렬(alignas 16 등)과 무관하게 &object == ChunkData 주소
 		T object;
+		Chunk* my_chunk_;
 
 	public:
 		void Free() {
@@ -72,19 +79,56 @@ private:
 		}
 	};
 
+private:
+	static constexpr int MAX_NUMA_NODES = 64;
+	static constexpr int NUMA_PREALLOC_CHUNKS = 2;
+
+	// NUMA 노드별 청크 풀 (다중 노드일 때만 사용, 노드별 첫 사용 시 생성)
+	// - 스레드의 첫 청크를 그 스레드가 도는 노드의 풀에서 받고, 이후 청크도 같은 풀에서 이어 받음
+	// - 청크는 자기를 낸 풀로만 반환되므로 노드 로컬 메모리가 다른 노드 스레드로 넘어가지 않음
+	// - 선할당 청크는 해당 노드 메모리 (LFObjectPool numa_node), 증설분은 같은 노드 스레드의 first-touch
+	LFObjectPool<Chunk>* GetChunkPool() {
+		if (!use_numa_) return &chunk_pool_;
+
+		const int node = ThreadPlacement::GetCurrentNumaNode();
+		if (node < 0 || MAX_NUMA_NODES <= node) return &chunk_pool_;
+
+		LFObjectPool<Chunk>* numa_pool = numa_chunk_pools_[node].load(std::memory_order_acquire);
+		if (nullptr == numa_pool) {
+			LFObjectPool<Chunk>* created = new LFObjectPool<Chunk>(NUMA_PREALLOC_CHUNKS, false, node);
+			if (numa_chunk_pools_[node].compare_exchange_strong(numa_pool, created, std::memory_order_acq_rel)) {
+				numa_pool = created;
+			}
+			else {
+				delete created;
+			}
+		}
+		return numa_pool;
+	}
+
 private:
 	LFObjectPool<Chunk> chunk_pool_;
+	std::atomic<LFObjectPool<Chunk>*> numa_chunk_pools_[MAX_NUMA_NODES] = {};
 	const int tls_index_;
 	const bool use_ctor_;
+	const bool use_numa_;
 	int count_ = 0;
 
 public:
 	int GetChunkCapacity() {
-		return chunk_pool_.GetCapacityCount();
+		int capacity = chunk_pool_.GetCapacityCount();
+		for (auto& numa_pool : numa_chunk_pools_) {
+			if (LFObjectPool<Chunk>* pool = numa_pool.load(std::memory_order_acquire)) capacity += pool->GetCapacityCount();
+		}
+		return capacity;
 	}
 
 	int GetChunkUseCount() {
-		return chunk_pool_.GetUseCount();
+		int use_count = chunk_pool_.GetUseCount();
+		for (auto& numa_pool : numa_chunk_pools_) {
+			if (LFObjectPool<Chunk>* pool = numa_pool.load(std::memory_order_acquire)) use_count += pool->GetUseCount();
+		}
+		return use_count;
 	}
 
 	int GetUseCount() {
@@ -102,8 +146,9 @@ public:
 
 		Chunk* chunk = (Chunk*)TlsGetValue(tls_index_);
 		if (nullptr == chunk) {
-			chunk = chunk_pool_.Alloc();
-			chunk->Set(&chunk_pool_, use_ctor_, tls_index_);
+			LFObjectPool<Chunk>* chunk_pool = GetChunkPool();
+			chunk = chunk_pool->Alloc();
+			chunk->Set(chunk_pool, use_ctor_, tls_index_);
 			TlsSetValue(tls_index_, chunk);
 		}
 
@@ -115,7 +160,7 @@ public:
 		InterlockedDecrement((LONG*)&count_);
 #endif
 
-		ChunkData* chunk_data = (ChunkData*)((char*)object - sizeof(Chunk*));
+		ChunkData* chunk_data = (ChunkData*)object;
 		chunk_data->Free();
 	}
 };
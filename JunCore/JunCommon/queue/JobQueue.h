@@ -1,10 +1,28 @@
 ﻿#pragma once
-#include <Windows.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <functional>
+#include <mutex>
+#include <string>
 #include <thread>
 #include <vector>
-#include <atomic>
-#include "../container/LFQueue.h"
+#include "../timer/LatencyHistogram.h"
+
+//------------------------------
+// 우선순위 단계 (0 = 가장 높음, 범위를 넘으면 BACKGROUND로 취급)
+// 로그 flush / DB 쓰기 / 암호화 같은 백그라운드 작업은 BACKGROUND로 제출
+//------------------------------
+enum JobPriority : uint32_t
+{
+    JOB_PRIORITY_CRITICAL   = 0,    // 지연 민감 (패킷 처리 등)
+    JOB_PRIORITY_NORMAL     = 1,
+    JOB_PRIORITY_BACKGROUND = 2,
+    JOB_PRIORITY_COUNT      = 3,
+};
 
 //------------------------------
 // Job - 패킷 처리 작업 단위
@@ -14,15 +32,23 @@ struct Job
     using JobFunction = std::function<void()>;
     
     JobFunction jobFunction;
-    DWORD priority = 0;  // 0 = highest priority
+    uint32_t priority = 0;  // 0 = highest priority
+    int64_t enqueueNs = 0;  // JobQueue::Enqueue 시각 (대기 시간 통계용)
     
     Job() = default;
-    Job(JobFunction&& func, DWORD prio = 0) 
+    Job(JobFunction&& func, uint32_t prio = 0) 
         : jobFunction(std::move(func)), priority(prio) {}
 };
 
 //------------------------------
-// JobQueue - Lock-free Job 큐
+// JobQueue - 우선순위별 Job 큐 (표준 라이브러리만 사용)
+//
+// - 우선순위마다 deque 하나, Dequeue는 항상 높은 우선순위부터 (엄격한 우선순위)
+// - 큐와 대기는 mutex 하나 + condition_variable
+//   대기 중인 소비자가 있을 때만 깨움 (notify 시스템콜 회피)
+// - 대기 수는 락 안에서만 바뀌므로 통계 조회(GetPendingCount)는 음수 / 찢어진 값을 보지 않음
+// - Shutdown: 이후 Enqueue 거부, 대기 중인 소비자 전부 깨움
+//   남은 Job은 계속 꺼낼 수 있고 비면 Dequeue가 false
 //------------------------------
 class JobQueue
 {
@@ -34,19 +60,33 @@ public:
     void Enqueue(Job&& job);
     void Enqueue(const Job& job);
     
-    // Job 처리 (Consumer) - 블로킹
-    bool Dequeue(Job& outJob, DWORD timeoutMs = INFINITE);
+    // Job 처리 (Consumer) - Job이 들어오거나 종료될 때까지 블로킹
+    bool Dequeue(Job& outJob);
+    // timeout까지만 대기 (0이면 대기 없이 확인만)
+    bool Dequeue(Job& outJob, std::chrono::milliseconds timeout);
     
-    // 통계
-    size_t GetPendingCount() const { return jobQueue.GetUseCount(); }
+    // 통계 (아무 스레드, 락 없이 조회)
+    size_t GetPendingCount() const { return pendingCount.load(std::memory_order_relaxed); }
+    size_t GetPendingCount(uint32_t priority) const { return priorityCounts[ClampPriority(priority)].load(std::memory_order_relaxed); }
     
     // 종료 신호
     void Shutdown();
     bool IsShutdown() const { return isShutdown.load(); }
 
+    static uint32_t ClampPriority(uint32_t priority) { return priority < JOB_PRIORITY_COUNT ? priority : JOB_PRIORITY_BACKGROUND; }
+    static int64_t NowNs();
+
 private:
-    LFQueue<Job> jobQueue;
-    HANDLE semaphore;
+    void Push(Job& job);
+    bool TryPop(Job& outJob);   // 락을 쥔 상태에서 호출
+
+private:
+    std::array<std::deque<Job>, JOB_PRIORITY_COUNT> jobQueues;
+    std::array<std::atomic<size_t>, JOB_PRIORITY_COUNT> priorityCounts;
+    std::atomic<size_t> pendingCount;
+    int waiterCount;            // queueLock 보호
+    std::mutex queueLock;
+    std::condition_variable waitCondition;
     std::atomic<bool> isShutdown;
 };
 
@@ -55,6 +95,14 @@ private:
 //------------------------------
 class ThreadPool
 {
+public:
+    // 우선순위별 구간 통계 (TakePriorityStats)
+    struct PriorityStats
+    {
+        LatencyHistogram::Snapshot waitUs;  // Submit -> 실행 시작
+        LatencyHistogram::Snapshot runUs;   // 실행 시간
+    };
+
 public:
     ThreadPool(size_t threadCount, const char* poolName = "ThreadPool");
     ~ThreadPool();
@@ -65,13 +113,21 @@ public:
     
     void Submit(Job&& job);
     void Submit(const Job& job);
+
+    // 우선순위 지정 제출 (JobPriority)
+    template<typename Func>
+    void SubmitWithPriority(uint32_t priority, Func&& func);
     
     // 통계 및 모니터링
     size_t GetPendingJobs() const { return jobQueue.GetPendingCount(); }
+    size_t GetPendingJobs(uint32_t priority) const { return jobQueue.GetPendingCount(priority); }
     size_t GetThreadCount() const { return workerThreads.size(); }
-    DWORD GetProcessedJobCount() const { return processedJobCount.load(); }
+    uint32_t GetProcessedJobCount() const { return processedJobCount.load(); }
+
+    // 우선순위별 대기/실행 시간 (누적값을 꺼내고 초기화, 아무 스레드)
+    std::array<PriorityStats, JOB_PRIORITY_COUNT> TakePriorityStats();
     
-    // 종료
+    // 종료 (제출 거부 -> 남은 Job 처리 -> Worker join)
     void Shutdown();
     bool IsShutdown() const { return isShutdown.load(); }
 
@@ -79,11 +135,18 @@ private:
     void WorkerThreadFunc();
     
 private:
+    struct PriorityCounters
+    {
+        LatencyHistogram waitUs;
+        LatencyHistogram runUs;
+    };
+
     JobQueue jobQueue;
     std::vector<std::thread> workerThreads;
     std::atomic<bool> isShutdown;
-    std::atomic<DWORD> processedJobCount;
+    std::atomic<uint32_t> processedJobCount;
     std::string poolName;
+    std::array<PriorityCounters, JOB_PRIORITY_COUNT> priorityCounters;
 };
 
 //------------------------------
@@ -91,60 +154,104 @@ private:
 //------------------------------
 
 inline JobQueue::JobQueue() 
-    : semaphore(CreateSemaphore(NULL, 0, MAXLONG, NULL))
+    : priorityCounts{}
+    , pendingCount(0)
+    , waiterCount(0)
     , isShutdown(false)
 {
-    if (semaphore == NULL) {
-        throw std::exception("Failed to create semaphore for JobQueue");
-    }
 }
 
 inline JobQueue::~JobQueue()
 {
     Shutdown();
-    if (semaphore != NULL) {
-        CloseHandle(semaphore);
-    }
+}
+
+inline int64_t JobQueue::NowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
 }
 
 inline void JobQueue::Enqueue(Job&& job)
 {
     if (isShutdown.load()) return;
     
-    jobQueue.Enqueue(std::move(job));
-    ReleaseSemaphore(semaphore, 1, NULL);
+    Push(job);
 }
 
 inline void JobQueue::Enqueue(const Job& job)
 {
     if (isShutdown.load()) return;
     
-    jobQueue.Enqueue(job);
-    ReleaseSemaphore(semaphore, 1, NULL);
+    Job copy(job);
+    Push(copy);
 }
 
-inline bool JobQueue::Dequeue(Job& outJob, DWORD timeoutMs)
+inline void JobQueue::Push(Job& job)
 {
-    if (isShutdown.load()) return false;
-    
-    DWORD waitResult = WaitForSingleObject(semaphore, timeoutMs);
-    if (waitResult != WAIT_OBJECT_0) {
-        return false;  // Timeout or error
+    job.priority = ClampPriority(job.priority);
+    job.enqueueNs = NowNs();
+
+    bool wake;
+    {
+        std::lock_guard<std::mutex> guard(queueLock);
+        priorityCounts[job.priority].fetch_add(1, std::memory_order_relaxed);
+        pendingCount.fetch_add(1, std::memory_order_relaxed);
+        jobQueues[job.priority].push_back(std::move(job));
+        wake = waiterCount > 0;
+    }
+
+    // 락 밖에서 깨움 (깨어난 소비자가 바로 락을 잡을 수 있도록)
+    if (wake) {
+        waitCondition.notify_one();
     }
-    
-    if (isShutdown.load()) return false;
-    
-    return jobQueue.Dequeue(&outJob);
+}
+
+inline bool JobQueue::TryPop(Job& outJob)
+{
+    for (uint32_t priority = 0; priority < JOB_PRIORITY_COUNT; ++priority) {
+        auto& queue = jobQueues[priority];
+        if (!queue.empty()) {
+            outJob = std::move(queue.front());
+            queue.pop_front();
+            priorityCounts[priority].fetch_sub(1, std::memory_order_relaxed);
+            pendingCount.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+inline bool JobQueue::Dequeue(Job& outJob)
+{
+    std::unique_lock<std::mutex> lock(queueLock);
+    waiterCount++;
+    waitCondition.wait(lock, [this]() { return pendingCount.load(std::memory_order_relaxed) > 0 || isShutdown.load(); });
+    waiterCount--;
+
+    // 종료 후에도 남은 Job은 꺼냄
+    return TryPop(outJob);
+}
+
+inline bool JobQueue::Dequeue(Job& outJob, std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(queueLock);
+    waiterCount++;
+    waitCondition.wait_for(lock, timeout, [this]() { return pendingCount.load(std::memory_order_relaxed) > 0 || isShutdown.load(); });
+    waiterCount--;
+
+    return TryPop(outJob);
 }
 
 inline void JobQueue::Shutdown()
 {
-    isShutdown.store(true);
-    
-    // 모든 대기중인 스레드를 깨우기 위해 세마포어 해제
-    for (int i = 0; i < 100; ++i) {  // 충분한 수만큼 신호
-        ReleaseSemaphore(semaphore, 1, NULL);
+    {
+        std::lock_guard<std::mutex> guard(queueLock);
+        isShutdown.store(true);
     }
+    
+    // 대기 중인 소비자 전부 깨움 (횟수 제한 없음)
+    waitCondition.notify_all();
 }
 
 //------------------------------
@@ -180,6 +287,14 @@ inline void ThreadPool::Submit(Func&& func, Args&&... args)
     jobQueue.Enqueue(std::move(job));
 }
 
+template<typename Func>
+inline void ThreadPool::SubmitWithPriority(uint32_t priority, Func&& func)
+{
+    if (isShutdown.load()) return;
+
+    jobQueue.Enqueue(Job(Job::JobFunction(std::forward<Func>(func)), priority));
+}
+
 inline void ThreadPool::Submit(Job&& job)
 {
     if (isShutdown.load()) return;
@@ -192,10 +307,21 @@ inline void ThreadPool::Submit(const Job& job)
     jobQueue.Enqueue(job);
 }
 
+inline std::array<ThreadPool::PriorityStats, JOB_PRIORITY_COUNT> ThreadPool::TakePriorityStats()
+{
+    std::array<PriorityStats, JOB_PRIORITY_COUNT> stats;
+    for (size_t i = 0; i < stats.size(); ++i) {
+        stats[i].waitUs = priorityCounters[i].waitUs.TakeSnapshot();
+        stats[i].runUs = priorityCounters[i].runUs.TakeSnapshot();
+    }
+    return stats;
+}
+
 inline void ThreadPool::Shutdown()
 {
     if (isShutdown.exchange(true)) return;  // 이미 종료 중
     
+    // Worker는 남은 Job을 모두 처리한 뒤 Dequeue가 false를 받으면 종료
     jobQueue.Shutdown();
     
     for (auto& thread : workerThreads) {
@@ -211,18 +337,25 @@ inline void ThreadPool::WorkerThreadFunc()
 {
     Job job;
     
-    while (!isShutdown.load()) {
-        if (jobQueue.Dequeue(job, 100)) {  // 100ms timeout
-            try {
-                if (job.jobFunction) {
-                    job.jobFunction();
-                    processedJobCount.fetch_add(1);
-                }
-            }
-            catch (...) {
-                // Job 실행 중 예외 발생 - 로그 출력하고 계속 진행
-                // 향후 Logger 통합 시 로깅 추가 예정
+    // 폴링 없이 Job이 들어오거나 종료될 때까지 대기
+    while (jobQueue.Dequeue(job)) {
+        const int64_t startNs = JobQueue::NowNs();
+        try {
+            if (job.jobFunction) {
+                job.jobFunction();
+                processedJobCount.fetch_add(1);
             }
         }
+        catch (...) {
+            // Job 실행 중 예외 발생 - 로그 출력하고 계속 진행
+            // 향후 Logger 통합 시 로깅 추가 예정
+        }
+
+        PriorityCounters& counters = priorityCounters[job.priority];
+        counters.waitUs.Record(static_cast<uint64_t>((std::max)(int64_t{0}, startNs - job.enqueueNs)) / 1000);
+        counters.runUs.Record(static_cast<uint64_t>((std::max)(int64_t{0}, JobQueue::NowNs() - startNs)) / 1000);
+
+        // 캡처한 자원을 다음 Job까지 붙잡지 않도록 비움
+        job.jobFunction = nullptr;
     }
-}
\ No newline at end of file
+}
@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include <Windows.h>    // SOCKADDR_IN / DWORD (JobQueue는 표준 라이브러리만 사용)
 #include "JobQueue.h"
 
 // 전방 선언
@@ -0,0 +1,166 @@
+﻿#include "ThreadPlacement.h"
+#include <bit>
+
+ThreadPlacement ThreadPlacement::Cores(std::vector<int> logicalCores)
+{
+    ThreadPlacement placement;
+    if (!logicalCores.empty())
+    {
+        placement.mode_ = Mode::CORES;
+        placement.cores_ = std::move(logicalCores);
+    }
+    return placement;
+}
+
+ThreadPlacement ThreadPlacement::NumaNode(int node, bool pinPerCore)
+{
+    ThreadPlacement placement;
+    if (0 <= node)
+    {
+        placement.mode_ = Mode::NUMA_NODE;
+        placement.numaNode_ = node;
+        placement.pinPerCore_ = pinPerCore;
+    }
+    return placement;
+}
+
+bool ThreadPlacement::ApplyToCurrentThread(int threadIndex) const
+{
+    GROUP_AFFINITY affinity = {};
+
+    switch (mode_)
+    {
+    case Mode::CORES:
+    {
+        const int core = cores_[threadIndex % cores_.size()];
+        if (!ToGroupAffinity(core, affinity))
+        {
+            return false;
+        }
+    } break;
+
+    case Mode::NUMA_NODE:
+    {
+        // 노드가 여러 프로세서 그룹에 걸친 경우 첫 그룹만 사용
+        if (!GetNumaNodeProcessorMaskEx(static_cast<USHORT>(numaNode_), &affinity) || affinity.Mask == 0)
+        {
+            return false;
+        }
+
+        if (pinPerCore_)
+        {
+            // 노드 마스크에서 (threadIndex % 코어 수)번째 비트 선택
+            uint64_t mask = static_cast<uint64_t>(affinity.Mask);
+            int skip = threadIndex % std::popcount(mask);
+            for (; 0 < skip; --skip)
+            {
+                mask &= mask - 1;
+            }
+            affinity.Mask = static_cast<KAFFINITY>(mask & (~mask + 1));
+        }
+    } break;
+
+    case Mode::ANY:
+    default:
+        return true;
+    }
+
+    return SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr) != FALSE;
+}
+
+std::string ThreadPlacement::ToString() const
+{
+    switch (mode_)
+    {
+    case Mode::CORES:
+    {
+        std::string result = "cores[";
+        for (size_t i = 0; i < cores_.size(); ++i)
+        {
+            if (i != 0)
+            {
+                result += ",";
+            }
+            result += std::to_string(cores_[i]);
+        }
+        return result + "]";
+    }
+    case Mode::NUMA_NODE:
+        return "numa" + std::to_string(numaNode_) + (pinPerCore_ ? "/pinned" : "");
+    default:
+        return "any";
+    }
+}
+
+int ThreadPlacement::GetLogicalCoreCount()
+{
+    return static_cast<int>(GetActiveProcessorCount(ALL_PROCESSOR_GROUPS));
+}
+
+int ThreadPlacement::GetNumaNodeCount()
+{
+    ULONG highestNode = 0;
+    if (!GetNumaHighestNodeNumber(&highestNode))
+    {
+        return 1;
+    }
+    return static_cast<int>(highestNode) + 1;
+}
+
+int ThreadPlacement::GetNumaNodeOfCore(int logicalCore)
+{
+    GROUP_AFFINITY affinity;
+    if (!ToGroupAffinity(logicalCore, affinity))
+    {
+        return -1;
+    }
+
+    PROCESSOR_NUMBER processor = {};
+    processor.Group = affinity.Group;
+    processor.Number = static_cast<BYTE>(std::countr_zero(static_cast<uint64_t>(affinity.Mask)));
+
+    USHORT node = 0;
+    if (!GetNumaNodeNumberFromProcessorEx(&processor, &node))
+    {
+        return -1;
+    }
+    return static_cast<int>(node);
+}
+
+int ThreadPlacement::GetCurrentNumaNode()
+{
+    PROCESSOR_NUMBER processor = {};
+    GetCurrentProcessorNumberEx(&processor);
+
+    USHORT node = 0;
+    if (!GetNumaNodeNumberFromProcessorEx(&processor, &node))
+    {
+        return -1;
+    }
+    return static_cast<int>(node);
+}
+
+bool ThreadPlacement::ToGroupAffinity(int logicalCore, GROUP_AFFINITY& out)
+{
+    if (logicalCore < 0)
+    {
+        return false;
+    }
+
+    // 그룹 순서대로 논리 코어 번호를 이어 붙인 것으로 간주
+    int base = 0;
+    const WORD groupCount = GetActiveProcessorGroupCount();
+    for (WORD group = 0; group < groupCount; ++group)
+    {
+        const int count = static_cast<int>(GetActiveProcessorCount(group));
+        if (logicalCore < base + count)
+        {
+            out = {};
+            out.Group = group;
+            out.Mask = static_cast<KAFFINITY>(1) << (logicalCore - base);
+            return true;
+        }
+        base += count;
+    }
+    return false;
+}
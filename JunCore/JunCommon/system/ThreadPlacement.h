@@ -0,0 +1,76 @@
+#pragma once
+#include <Windows.h>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+/**
+ * @brief 스레드 CPU 코어 / NUMA 노드 배치 정책
+ *
+ * - ANY       : OS 스케줄러에 맡김 (기본값)
+ * - CORES     : 스레드 i를 논리 코어 cores[i % n] 하나에 고정
+ * - NUMA_NODE : 스레드를 NUMA 노드의 코어 집합으로 제한 (pinPerCore 시 노드 내 코어 하나씩 고정)
+ * - 스레드가 시작 직후 자신에게 ApplyToCurrentThread(index)를 호출하는 방식
+ * - 프로세서 그룹(64 논리 코어 초과) 환경 지원
+ */
+class ThreadPlacement
+{
+public:
+    enum class Mode : uint8_t
+    {
+        ANY,
+        CORES,
+        NUMA_NODE,
+    };
+
+public:
+    ThreadPlacement() = default;
+
+    static ThreadPlacement Any() { return ThreadPlacement(); }
+
+    /**
+     * @brief 논리 코어 목록에 스레드를 하나씩 고정
+     * @param logicalCores 전체 프로세서 그룹 기준 논리 코어 번호 (0 ~ GetLogicalCoreCount()-1)
+     * @note 스레드 수가 코어 수보다 많으면 라운드로빈으로 공유
+     */
+    static ThreadPlacement Cores(std::vector<int> logicalCores);
+
+    /**
+     * @brief NUMA 노드에 스레드 배치
+     * @param node NUMA 노드 번호 (0 ~ GetNumaNodeCount()-1)
+     * @param pinPerCore true면 노드 내 코어에 하나씩 고정, false면 노드 전체 코어 중 OS가 선택
+     */
+    static ThreadPlacement NumaNode(int node, bool pinPerCore = false);
+
+    bool IsEnabled() const { return mode_ != Mode::ANY; }
+    Mode GetMode() const { return mode_; }
+
+    /**
+     * @brief 호출 스레드에 배치 정책 적용
+     * @param threadIndex 같은 정책을 공유하는 스레드 내 순번 (코어 선택에 사용)
+     * @return 성공(또는 ANY) 시 true
+     */
+    bool ApplyToCurrentThread(int threadIndex) const;
+
+    // 로그 출력용 ("any", "cores[0,2]", "numa1/pinned")
+    std::string ToString() const;
+
+public:
+    //------------------------------
+    // 시스템 토폴로지 조회
+    //------------------------------
+    static int GetLogicalCoreCount();
+    static int GetNumaNodeCount();
+    static int GetNumaNodeOfCore(int logicalCore);
+    static int GetCurrentNumaNode();
+
+private:
+    // 전체 논리 코어 번호 -> (프로세서 그룹, 그룹 내 비트)
+    static bool ToGroupAffinity(int logicalCore, GROUP_AFFINITY& out);
+
+private:
+    Mode mode_ = Mode::ANY;
+    std::vector<int> cores_;
+    int numaNode_ = -1;
+    bool pinPerCore_ = false;
+};
@@ -0,0 +1,137 @@
+﻿#pragma once
+
+#include <atomic>
+#include <array>
+#include <vector>
+#include <bit>
+#include <cstdint>
+
+// 동시 기록 가능한 로그-선형 지연 히스토그램 (HdrHistogram 축약판)
+//
+// 멀티스레드 사용법:
+//   - Record(): 여러 스레드에서 동시 호출 (relaxed atomic 증가, lock 없음)
+//   - TakeSnapshot(): 집계 스레드에서 주기적으로 호출, 누적값을 꺼내고 0으로 초기화
+//
+// 정밀도:
+//   - 0 ~ 63은 정확, 이후 2배 구간마다 64개 선형 버킷 (상대 오차 1/64 이하)
+//   - 단위는 호출자가 정함 (보통 us), 2^38 이상은 마지막 버킷으로 포화
+class LatencyHistogram
+{
+public:
+    static constexpr int SUB_BUCKET_BITS    = 6;
+    static constexpr int SUB_BUCKET_COUNT   = 1 << SUB_BUCKET_BITS;
+    static constexpr int RANGE_COUNT        = 32;
+    static constexpr int BUCKET_COUNT       = SUB_BUCKET_COUNT * (RANGE_COUNT + 1);
+
+    // 구간 집계 결과 (TakeSnapshot / Merge)
+    struct Snapshot
+    {
+        std::vector<uint64_t> buckets = std::vector<uint64_t>(BUCKET_COUNT, 0);
+        uint64_t count  = 0;
+        uint64_t sum    = 0;
+        uint64_t max    = 0;
+
+        double Mean() const { return count ? static_cast<double>(sum) / count : 0.0; }
+
+        // percentile: 0.0 ~ 100.0, 해당 버킷의 상한값 반환 (max는 넘지 않음)
+        uint64_t ValueAtPercentile(double percentile) const
+        {
+            if (count == 0)
+            {
+                return 0;
+            }
+
+            uint64_t target = static_cast<uint64_t>(percentile / 100.0 * count + 0.5);
+            target = (target == 0) ? 1 : (target > count ? count : target);
+
+            uint64_t seen = 0;
+            for (int i = 0; i < BUCKET_COUNT; ++i)
+            {
+                seen += buckets[i];
+                if (seen >= target)
+                {
+                    const uint64_t upper = BucketUpperBound(i);
+                    return upper < max ? upper : max;
+                }
+            }
+            return max;
+        }
+
+        void Merge(const Snapshot& other)
+        {
+            for (int i = 0; i < BUCKET_COUNT; ++i)
+            {
+                buckets[i] += other.buckets[i];
+            }
+            count += other.count;
+            sum += other.sum;
+            max = (other.max > max) ? other.max : max;
+        }
+    };
+
+public:
+    void Record(uint64_t value)
+    {
+        buckets_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(value, std::memory_order_relaxed);
+
+        uint64_t currentMax = max_.load(std::memory_order_relaxed);
+        while (currentMax < value && !max_.compare_exchange_weak(currentMax, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    // 누적값을 꺼내고 초기화 (기록과 동시에 호출되면 일부 샘플은 다음 스냅샷으로 넘어감)
+    Snapshot TakeSnapshot()
+    {
+        Snapshot snapshot;
+        for (int i = 0; i < BUCKET_COUNT; ++i)
+        {
+            snapshot.buckets[i] = buckets_[i].exchange(0, std::memory_order_relaxed);
+            snapshot.count += snapshot.buckets[i];
+        }
+        count_.store(0, std::memory_order_relaxed);
+        snapshot.sum = sum_.exchange(0, std::memory_order_relaxed);
+        snapshot.max = max_.exchange(0, std::memory_order_relaxed);
+        return snapshot;
+    }
+
+public:
+    static int BucketIndex(uint64_t value)
+    {
+        if (value < SUB_BUCKET_COUNT)
+        {
+            return static_cast<int>(value);
+        }
+
+        // range r (1~): [64 * 2^(r-1), 64 * 2^r), 간격 2^(r-1)
+        const int range = static_cast<int>(std::bit_width(value)) - SUB_BUCKET_BITS;
+        if (RANGE_COUNT < range)
+        {
+            return BUCKET_COUNT - 1;
+        }
+
+        const int sub = static_cast<int>(value >> (range - 1)) - SUB_BUCKET_COUNT;
+        return SUB_BUCKET_COUNT * range + sub;
+    }
+
+    static uint64_t BucketUpperBound(int index)
+    {
+        if (index < SUB_BUCKET_COUNT)
+        {
+            return static_cast<uint64_t>(index);
+        }
+
+        const int range = index / SUB_BUCKET_COUNT;
+        const uint64_t sub = static_cast<uint64_t>(index % SUB_BUCKET_COUNT);
+        const uint64_t lower = (SUB_BUCKET_COUNT + sub) << (range - 1);
+        return lower + (1ull << (range - 1)) - 1;
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets_{};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> max_{0};
+};
@@ -15,6 +15,8 @@ GameObject::GameObject(GameScene* scene, float x, float y, float z)
 
 GameObject::~GameObject()
 {
+    // Destroy를 거치지 않고 삭제된 경우 슬롯 반납 (이미 해제됐으면 무시됨)
+    GameObjectManager::Instance().Unregister(m_sn);
 }
 
 void GameObject::Destroy()
@@ -31,7 +33,7 @@ void GameObject::Destroy()
         // 삭제 전 이벤트 발행 (구독자들에게 알림)
         OnBeforeDestroy.Invoke();
 
-        // GameObjectManager에서 해제
+        // GameObjectManager에서 해제 (진행 중인 PostTo가 끝날 때까지 대기)
         GameObjectManager::Instance().Unregister(m_sn);
 
         // 삭제 마킹 (이후 PostJob 거부, Flush 후 delete)
@@ -18,7 +18,7 @@ GameObjectManager& GameObjectManager::Instance()
     return instance;
 }
 
-void GameObjectManager::Initialize(JobThread* coreThread)
+void GameObjectManager::Initialize(JobThreadBase* coreThread)
 {
     if (coreThread == nullptr)
     {
@@ -34,31 +34,19 @@ void GameObjectManager::Register(GameObject* obj)
         return;
     }
 
-    uint64_t sn = obj->GetSN();
-    PostJob([this, sn, obj]() {
-        m_objects[sn] = obj;
-    });
+    m_objects.Publish(obj->GetSN(), obj);
 }
 
 void GameObjectManager::Unregister(uint64_t sn)
 {
-    PostJob([this, sn]() {
-        m_objects.erase(sn);
-    });
+    m_objects.Remove(sn);
 }
 
-void GameObjectManager::PostTo(uint64_t sn, Job job)
+bool GameObjectManager::PostTo(uint64_t sn, Job job)
 {
-    PostJob([this, sn, job = std::move(job)]() {
-        auto it = m_objects.find(sn);
-        if (it == m_objects.end())
-        {
-            return;
-        }
-
-        if (GameObject* obj = it->second)
-        {
-			obj->PostJob(std::move(job));
-		}
+    bool posted = false;
+    m_objects.Visit(sn, [&job, &posted](GameObject* obj) {
+        posted = obj->PostJob(std::move(job));
     });
+    return posted;
 }
\ No newline at end of file
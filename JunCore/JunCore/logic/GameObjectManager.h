@@ -2,22 +2,20 @@
 #include "JobObject.h"
 #include "GameObject.h"
 #include "GameScene.h"
-#include <unordered_map>
-#include <atomic>
+#include "../../JunCommon/container/LFSlotMap.h"
 #include <cstdint>
 #include <type_traits>
 
 //------------------------------
 // GameObjectManager - 전역 GameObject 관리자
-// JobObject 상속으로 코어 JobThread에서 실행됨
-// - SN 발급: atomic (락 불필요)
-// - 등록/해제/조회: JobThread에서 직렬 처리 (락 불필요)
+// JobObject 상속으로 코어 JobThread에서 실행됨 (매니저 단위 작업용)
+// - SN = LFSlotMap 세대 핸들 (삭제된 오브젝트의 SN은 재사용되지 않음)
+// - 등록/해제/조회: LFSlotMap (락 불필요, 어느 스레드에서나 즉시 처리)
 //------------------------------
 class GameObjectManager : public JobObject
 {
 private:
-    std::unordered_map<uint64_t, GameObject*> m_objects;
-    std::atomic<uint64_t> m_nextSN{1};
+    LFSlotMap<GameObject> m_objects;
 
     // 싱글톤
     GameObjectManager();
@@ -36,14 +34,15 @@ public:
     // 초기화 (Server에서 호출)
     // 코어 JobThread 설정
     //------------------------------
-    void Initialize(JobThread* coreThread);
+    void Initialize(JobThreadBase* coreThread);
 
     //------------------------------
-    // SN 발급 (atomic - 락 불필요, 어디서든 호출 가능)
+    // SN 발급 (슬롯 예약 - 락 불필요, 어디서든 호출 가능)
+    // Register 전까지는 PostTo 대상이 아님
     //------------------------------
     uint64_t GenerateSN()
     {
-        return m_nextSN.fetch_add(1);
+        return m_objects.Allocate();
     }
 
     //------------------------------
@@ -66,20 +65,19 @@ public:
     }
 
     //------------------------------
-    // GameObject 등록 (GameScene::Enter에서 호출)
-    // JobObject의 PostJob으로 처리됨
+    // GameObject 등록 (GameScene::Enter에서 호출, 다시 불러도 안전)
     //------------------------------
     void Register(GameObject* obj);
 
     //------------------------------
-    // GameObject 해제 (OnBeforeDestroy에서 호출)
-    // JobObject의 PostJob으로 처리됨
+    // GameObject 해제 (Destroy / 소멸자에서 호출, 이미 해제된 SN이면 무시)
+    // 반환 후에는 이 SN으로 진행 중인 PostTo가 없음 (MarkForDelete 전에 호출)
     //------------------------------
     void Unregister(uint64_t sn);
 
     //------------------------------
-    // 크로스 스레드 Job 전달
-    // JobThread에서 대상 찾아서 PostJob
+    // 크로스 스레드 Job 전달 (아무 스레드, 대상 큐로 한 번에)
+    // 등록 전 / 해제된 SN이면 Job을 버리고 false
     //------------------------------
-    void PostTo(uint64_t sn, Job job);
+    bool PostTo(uint64_t sn, Job job);
 };
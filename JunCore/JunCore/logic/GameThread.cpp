@@ -5,6 +5,8 @@
 GameThread::GameThread()
     : JobThread()
 {
+    m_flushBudget.maxJobs = DEFAULT_FLUSH_MAX_JOBS;
+    m_flushBudget.maxTime = DEFAULT_FLUSH_MAX_TIME;
 }
 
 GameThread::~GameThread()
@@ -37,6 +39,7 @@ void GameThread::Start()
     m_lastFrameTime = std::chrono::steady_clock::now();
 
     m_worker = std::thread([this]() {
+        ApplyPlacement();
         Run();
     });
 }
@@ -54,9 +57,16 @@ void GameThread::Run()
     Time::SetTime(0.0f);
     Time::SetFrameCount(0);
 
+    using StatClock = std::chrono::steady_clock;
+    auto elapsedNs = [](StatClock::time_point from, StatClock::time_point to)
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count());
+    };
+
     while (m_running.load())
     {
         float dt = CalcDeltaTime();
+        const auto frameStart = StatClock::now();
 
         // Time 갱신 (TLS)
         Time::SetDeltaTime(dt);
@@ -67,9 +77,14 @@ void GameThread::Run()
         m_fixedTimeAccum += dt;
 
         // ──────── 1. JobObject 플러시 ────────
+        // 만료된 타이머 Job을 먼저 넣어서 이번 프레임에 실행
+        // JobObject당 예산 초과분은 다음 프레임으로
+        ProcessTimers();
         ProcessJobObjects();
+        const auto jobEnd = StatClock::now();
 
         // ──────── 2. FixedUpdate (고정 간격) ────────
+        uint64_t fixedSteps = 0;
         while (m_fixedTimeAccum >= m_fixedTimeStep)
         {
             for (auto* scene : m_scenes)
@@ -78,13 +93,23 @@ void GameThread::Run()
             }
 
             m_fixedTimeAccum -= m_fixedTimeStep;
+            fixedSteps++;
         }
+        const auto fixedEnd = StatClock::now();
 
         // ──────── 3. Update (프레임당 1회) ────────
         for (auto* scene : m_scenes)
         {
             scene->Update();
         }
+        const auto frameEnd = StatClock::now();
+
+        m_statFrames.fetch_add(1, std::memory_order_relaxed);
+        m_statFixedSteps.fetch_add(fixedSteps, std::memory_order_relaxed);
+        m_statJobNs.fetch_add(elapsedNs(frameStart, jobEnd), std::memory_order_relaxed);
+        m_statFixedUpdateNs.fetch_add(elapsedNs(jobEnd, fixedEnd), std::memory_order_relaxed);
+        m_statUpdateNs.fetch_add(elapsedNs(fixedEnd, frameEnd), std::memory_order_relaxed);
+        m_frameWorkUs.Record(elapsedNs(frameStart, frameEnd) / 1000);
 
         // ──────── 4. 프레임 대기 ────────
         // 60 FPS 목표 (16.66ms)
@@ -99,8 +124,24 @@ void GameThread::Run()
         }
     }
 
-    // 종료 전 남은 JobObject 모두 처리
-    ProcessJobObjects();
+    // 종료 전 남은 JobObject 처리 (시간 상한)
+    DrainJobObjects();
+}
+
+GameThread::FrameStats GameThread::TakeFrameStats()
+{
+    FrameStats stats;
+    stats.frames = m_statFrames.exchange(0, std::memory_order_relaxed);
+    stats.fixedSteps = m_statFixedSteps.exchange(0, std::memory_order_relaxed);
+    stats.jobNs = m_statJobNs.exchange(0, std::memory_order_relaxed);
+    stats.fixedUpdateNs = m_statFixedUpdateNs.exchange(0, std::memory_order_relaxed);
+    stats.updateNs = m_statUpdateNs.exchange(0, std::memory_order_relaxed);
+    stats.frameWorkUs = m_frameWorkUs.TakeSnapshot();
+
+    const uint64_t budgetExhausted = GetBudgetExhaustedCount();
+    stats.budgetYields = budgetExhausted - m_reportedBudgetExhausted;
+    m_reportedBudgetExhausted = budgetExhausted;
+    return stats;
 }
 
 float GameThread::CalcDeltaTime()
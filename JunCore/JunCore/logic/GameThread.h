@@ -1,8 +1,10 @@
 #pragma once
 #include "JobThread.h"
 #include "Time.h"
+#include "../../JunCommon/timer/LatencyHistogram.h"
 #include <vector>
 #include <chrono>
+#include <atomic>
 
 class GameScene;
 
@@ -20,7 +22,35 @@ private:
 
     std::chrono::steady_clock::time_point m_lastFrameTime;
 
+    // 프레임 단계별 누적 비용 (ns, TakeFrameStats에서 수거)
+    std::atomic<uint64_t> m_statFrames{0};
+    std::atomic<uint64_t> m_statFixedSteps{0};
+    std::atomic<uint64_t> m_statJobNs{0};
+    std::atomic<uint64_t> m_statFixedUpdateNs{0};
+    std::atomic<uint64_t> m_statUpdateNs{0};
+    LatencyHistogram m_frameWorkUs;     // 프레임당 작업 시간 (sleep 제외)
+    uint64_t m_reportedBudgetExhausted = 0;     // TakeFrameStats 호출 스레드 전용
+
+    // 기본 Flush 예산: Job이 몰린 Player 하나가 프레임(FixedUpdate)을 밀지 못하게 함
+    static constexpr uint32_t DEFAULT_FLUSH_MAX_JOBS = 256;
+    static constexpr std::chrono::microseconds DEFAULT_FLUSH_MAX_TIME{2000};
+
 public:
+    //------------------------------
+    // 프레임 비용 통계 (마지막 TakeFrameStats 이후 구간)
+    //------------------------------
+    struct FrameStats
+    {
+        uint64_t frames = 0;
+        uint64_t fixedSteps = 0;
+        uint64_t jobNs = 0;             // JobObject 플러시 (패킷 핸들러 Job)
+        uint64_t fixedUpdateNs = 0;     // FixedUpdate (이동/AOI/브로드캐스트)
+        uint64_t updateNs = 0;          // Update
+        uint64_t budgetYields = 0;      // Flush 예산 소진으로 다음 프레임으로 넘긴 횟수
+        LatencyHistogram::Snapshot frameWorkUs;
+    };
+
+
     GameThread();
     virtual ~GameThread() override;
 
@@ -42,6 +72,11 @@ public:
     void SetFixedTimeStep(float timeStep) { m_fixedTimeStep = timeStep; }
     float GetFixedTimeStep() const { return m_fixedTimeStep; }
 
+    //------------------------------
+    // 프레임 비용 통계 수거 (다른 스레드에서 호출 가능, 호출 시 초기화)
+    //------------------------------
+    FrameStats TakeFrameStats();
+
 protected:
     //------------------------------
     // 메인 루프 (override)
@@ -0,0 +1,235 @@
+﻿#pragma once
+#include "../../JunCommon/pool/LFObjectPool.h"
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+//------------------------------
+// Job - 처리할 작업 단위 (이동 전용)
+//
+// std::function 대체:
+// - INLINE_SIZE 이하 람다는 Job 내부에 저장 (PostJob당 힙 할당 없음)
+//   예: [player, cur_pos, dest_pos] (Player* + game::Pos 2개)
+// - 초과분은 크기 등급별 LFObjectPool 블록에 저장, 등급보다 크면 new
+// - 복사 불가 (큐에는 이동으로 들어가고 나옴), 이동 전용 캡처(unique_ptr 등)도 허용
+//------------------------------
+class Job
+{
+public:
+    // 저장소 16바이트 정렬 고정 (max_align_t는 MSVC x64 8 / GCC 16이라 그대로 쓰면 sizeof가 120 / 128로 갈림)
+    static constexpr size_t INLINE_SIZE = 112;
+    static constexpr size_t INLINE_ALIGN = 16;
+
+public:
+    Job() noexcept = default;
+    Job(std::nullptr_t) noexcept {}
+
+    template<typename F,
+             typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Job> &&
+                                         std::is_invocable_r_v<void, std::decay_t<F>&>>>
+    Job(F&& func)
+    {
+        using Fn = std::decay_t<F>;
+
+        if constexpr (FitsInline<Fn>)
+        {
+            ::new (static_cast<void*>(m_storage)) Fn(std::forward<F>(func));
+            m_ops = &InlineOps<Fn>::ops;
+        }
+        else
+        {
+            static_assert(alignof(Fn) <= INLINE_ALIGN, "Job: over-aligned callable");
+
+            void* block = SpillAlloc<sizeof(Fn)>();
+            try
+            {
+                ::new (block) Fn(std::forward<F>(func));
+            }
+            catch (...)
+            {
+                SpillFree<sizeof(Fn)>(block);
+                throw;
+            }
+            *reinterpret_cast<void**>(m_storage) = block;
+            m_ops = &SpillOps<Fn>::ops;
+        }
+    }
+
+    Job(Job&& other) noexcept
+    {
+        MoveFrom(other);
+    }
+
+    Job& operator=(Job&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    Job& operator=(std::nullptr_t) noexcept
+    {
+        Reset();
+        return *this;
+    }
+
+    Job(const Job&) = delete;
+    Job& operator=(const Job&) = delete;
+
+    ~Job()
+    {
+        Reset();
+    }
+
+    void operator()()
+    {
+        m_ops->invoke(m_storage);
+    }
+
+    explicit operator bool() const noexcept { return m_ops != nullptr; }
+
+    // 할당 없이 Job 내부에 저장되었는지 (통계/벤치마크용)
+    bool IsInline() const noexcept { return m_ops != nullptr && m_ops->isInline; }
+
+    void Reset() noexcept
+    {
+        if (m_ops != nullptr)
+        {
+            m_ops->destroy(m_storage);
+            m_ops = nullptr;
+        }
+    }
+
+private:
+    struct Ops
+    {
+        void (*invoke)(void* storage);
+        void (*relocate)(void* dst, void* src) noexcept;   // src -> dst 이동 후 src 정리
+        void (*destroy)(void* storage) noexcept;
+        bool isInline;
+    };
+
+    template<typename Fn>
+    static constexpr bool FitsInline =
+        sizeof(Fn) <= INLINE_SIZE &&
+        alignof(Fn) <= INLINE_ALIGN &&
+        std::is_nothrow_move_constructible_v<Fn>;
+
+    //------------------------------
+    // 인라인 저장: 이동 시 람다 자체를 이동
+    //------------------------------
+    template<typename Fn>
+    struct InlineOps
+    {
+        static Fn* Get(void* storage) { return std::launder(reinterpret_cast<Fn*>(storage)); }
+
+        static void Invoke(void* storage) { (*Get(storage))(); }
+
+        static void Relocate(void* dst, void* src) noexcept
+        {
+            Fn* from = Get(src);
+            ::new (dst) Fn(std::move(*from));
+            from->~Fn();
+        }
+
+        static void Destroy(void* storage) noexcept { Get(storage)->~Fn(); }
+
+        static constexpr Ops ops{ &Invoke, &Relocate, &Destroy, true };
+    };
+
+    //------------------------------
+    // 외부 블록 저장: 이동 시 포인터만 이동
+    //------------------------------
+    template<typename Fn>
+    struct SpillOps
+    {
+        static Fn* Get(void* storage) { return std::launder(reinterpret_cast<Fn*>(*reinterpret_cast<void**>(storage))); }
+
+        static void Invoke(void* storage) { (*Get(storage))(); }
+
+        static void Relocate(void* dst, void* src) noexcept
+        {
+            *reinterpret_cast<void**>(dst) = *reinterpret_cast<void**>(src);
+        }
+
+        static void Destroy(void* storage) noexcept
+        {
+            Fn* fn = Get(storage);
+            fn->~Fn();
+            SpillFree<sizeof(Fn)>(fn);
+        }
+
+        static constexpr Ops ops{ &Invoke, &Relocate, &Destroy, false };
+    };
+
+    //------------------------------
+    // 외부 블록 풀 (256 / 1024 바이트 등급)
+    // 정적 소멸 순서와 무관하게 쓸 수 있도록 풀은 해제하지 않음
+    // (종료 시점 싱글톤 JobObject 소멸자가 남은 Job을 정리할 수 있음)
+    //------------------------------
+    template<size_t N>
+    struct alignas(INLINE_ALIGN) SpillBlock
+    {
+        unsigned char bytes[N];
+    };
+
+    static constexpr size_t SpillClass(size_t size)
+    {
+        return size <= 256 ? 256 : (size <= 1024 ? 1024 : 0);
+    }
+
+    template<size_t N>
+    static LFObjectPool<SpillBlock<N>>& SpillPool()
+    {
+        static LFObjectPool<SpillBlock<N>>* pool = new LFObjectPool<SpillBlock<N>>();
+        return *pool;
+    }
+
+    template<size_t Size>
+    static void* SpillAlloc()
+    {
+        constexpr size_t blockSize = SpillClass(Size);
+        if constexpr (blockSize == 0)
+        {
+            return ::operator new(Size);
+        }
+        else
+        {
+            return SpillPool<blockSize>().Alloc();
+        }
+    }
+
+    template<size_t Size>
+    static void SpillFree(void* block) noexcept
+    {
+        constexpr size_t blockSize = SpillClass(Size);
+        if constexpr (blockSize == 0)
+        {
+            ::operator delete(block);
+        }
+        else
+        {
+            SpillPool<blockSize>().Free(static_cast<SpillBlock<blockSize>*>(block));
+        }
+    }
+
+    void MoveFrom(Job& other) noexcept
+    {
+        if (other.m_ops != nullptr)
+        {
+            other.m_ops->relocate(m_storage, other.m_storage);
+            m_ops = other.m_ops;
+            other.m_ops = nullptr;
+        }
+    }
+
+private:
+    alignas(INLINE_ALIGN) unsigned char m_storage[INLINE_SIZE];
+    const Ops* m_ops = nullptr;
+};
+
+static_assert(sizeof(Job) == 128, "Job: INLINE_SIZE + Ops 포인터가 16바이트 정렬로 128바이트");
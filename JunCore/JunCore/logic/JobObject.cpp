@@ -1,6 +1,121 @@
 ﻿#include "JobObject.h"
-#include "JobThread.h"
+#include "JobStats.h"
+#include "JobThreadBase.h"
+#include "TimerWheel.h"
+#include "../../JunCommon/pool/LFObjectPoolTLS.h"
+#include <algorithm>
 #include <stdexcept>
+#include <utility>
+
+namespace
+{
+    thread_local JobObject* t_currentJobObject = nullptr;
+
+    // Flush 동안 GetCurrent가 이 JobObject를 가리키게 함 (코루틴 복귀 대상)
+    struct CurrentJobObjectScope
+    {
+        JobObject* prev;
+
+        explicit CurrentJobObjectScope(JobObject* current) : prev(t_currentJobObject) { t_currentJobObject = current; }
+        ~CurrentJobObjectScope() { t_currentJobObject = prev; }
+    };
+
+    // Flush 1회 계측 (JobStats가 켜진 Flush에서만 기록, 타입 / 스레드 카운터 양쪽에)
+    struct FlushStatsRecorder
+    {
+        JobStatsCounters* typeStats = nullptr;
+        JobStatsCounters* threadStats = nullptr;
+        int64_t stamp = 0;
+        uint64_t executed = 0;
+
+        void Begin(JobStatsCounters* type, JobStatsCounters* thread, int32_t queueDepth)
+        {
+            typeStats = type;
+            threadStats = thread;
+            typeStats->queueDepth.Record(static_cast<uint64_t>(queueDepth));
+            threadStats->queueDepth.Record(static_cast<uint64_t>(queueDepth));
+            stamp = JobStats::Now();
+        }
+
+        void BeforeJob(int64_t enqueueStamp)
+        {
+            if (enqueueStamp != 0 && stamp > enqueueStamp)
+            {
+                const uint64_t waitUs = static_cast<uint64_t>(stamp - enqueueStamp) / 1000;
+                typeStats->waitUs.Record(waitUs);
+                threadStats->waitUs.Record(waitUs);
+            }
+        }
+
+        void AfterJob()
+        {
+            const int64_t now = JobStats::Now();
+            const uint64_t runUs = static_cast<uint64_t>(now - stamp) / 1000;
+            typeStats->runUs.Record(runUs);
+            threadStats->runUs.Record(runUs);
+            stamp = now;
+            executed++;
+        }
+
+        ~FlushStatsRecorder()
+        {
+            if (typeStats != nullptr)
+            {
+                typeStats->jobsPerFlush.Record(executed);
+                threadStats->jobsPerFlush.Record(executed);
+            }
+        }
+    };
+}
+
+//------------------------------
+// 만료된 타이머를 owner 큐에 넣는 Job
+// 실행되지 못하고 버려지면 (삭제 마킹 후 폐기 등) 소멸자에서 노드 반납
+//------------------------------
+struct JobObject::TimerFire
+{
+    TimerNode* node;
+
+    explicit TimerFire(TimerNode* timer) : node(timer) {}
+    TimerFire(TimerFire&& other) noexcept : node(std::exchange(other.node, nullptr)) {}
+    TimerFire& operator=(TimerFire&&) = delete;
+
+    ~TimerFire()
+    {
+        if (node != nullptr)
+        {
+            ReleaseTimer(node);
+        }
+    }
+
+    void operator()()
+    {
+        TimerNode* timer = std::exchange(node, nullptr);
+        timer->owner->RunTimer(timer);
+    }
+};
+
+LFObjectPoolTLS<JobObject::JobNode>& JobObject::GetJobNodePool()
+{
+    // 프로세스 종료 시점까지 살아있는 싱글톤 JobObject가 있으므로 의도적으로 해제하지 않음
+    static auto* pool = new LFObjectPoolTLS<JobNode>();
+    return *pool;
+}
+
+JobObject::JobNode* JobObject::AllocJobNode(Job&& job)
+{
+    JobNode* node = GetJobNodePool().Alloc();
+    node->job = std::move(job);
+    return node;
+}
+
+void JobObject::FreeJobNode(JobNode* node)
+{
+    // 청크 재사용 시 생성자를 다시 부르지 않으므로 빈 상태로 반납
+    node->job.Reset();
+    node->enqueueStamp = 0;
+    GetJobNodePool().Free(node);
+}
 
 JobObject::JobObject()
     : m_pJobThread(nullptr)
@@ -8,7 +123,7 @@ JobObject::JobObject()
     // 기본 생성자 - Initialize에서 JobThread 설정 필수
 }
 
-JobObject::JobObject(JobThread* jobThread)
+JobObject::JobObject(JobThreadBase* jobThread)
     : m_pJobThread(jobThread)
 {
     if (jobThread == nullptr)
@@ -19,11 +134,10 @@ JobObject::JobObject(JobThread* jobThread)
 
 JobObject::~JobObject()
 {
-    // 남은 Job 정리
-    Job job;
-    while (m_jobQueue.Dequeue(&job))
+    // 남은 Job 정리 (소멸자에서는 실행하지 않고 버림)
+    while (JobNode* node = m_jobQueue.Dequeue())
     {
-        // 소멸자에서는 실행하지 않고 버림
+        FreeJobNode(node);
     }
 }
 
@@ -35,13 +149,19 @@ bool JobObject::PostJob(Job job)
         return false;
     }
 
-    m_jobQueue.Enqueue(std::move(job));
+    JobNode* node = AllocJobNode(std::move(job));
+    if (JobStats::IsEnabled())
+    {
+        node->enqueueStamp = JobStats::Now();
+        m_stampedJobs.fetch_add(1, std::memory_order_relaxed);
+    }
+    m_jobQueue.Enqueue(node);
 
     // CAS로 스케줄 시도
     bool expected = false;
     if (m_processing.compare_exchange_strong(expected, true))
     {
-        m_pJobThread->GetJobQueue()->Enqueue(this);
+        m_pJobThread->Schedule(this);
     }
 
     return true;
@@ -52,7 +172,173 @@ void JobObject::MarkForDelete()
     m_markedForDelete.store(true);
 }
 
-void JobObject::SetJobThread(JobThread* thread)
+bool JobObject::ReleaseForDelete()
+{
+    // 버리는 TimerFire가 참조를 놓다가 여기서 delete되지 않도록 정리가 끝날 때까지 고정
+    AddRef();
+
+    // 자기 참조는 처음 한 번만 놓음 (이후 호출은 늦게 들어온 Job을 버리려고 재스케줄된 것)
+    const bool releaseSelf = !m_deleteReleased;
+    m_deleteReleased = true;
+
+    // 남은 Job 폐기 (TimerFire는 소멸자에서 자기 참조를 놓음)
+    while (JobNode* node = m_jobQueue.Dequeue())
+    {
+        FreeJobNode(node);
+    }
+
+    // 삭제 마킹 확인을 통과한 PostJob(다른 스레드의 TimerFire 등)이 위 폐기 뒤에 들어올 수 있음
+    // Flush처럼 스케줄을 놓고 재확인 -> 남아 있으면 다시 스케줄되어 Deleted로 이 함수가 또 불림
+    m_processing.store(false);
+    if (!m_jobQueue.IsEmpty())
+    {
+        bool expected = false;
+        if (m_processing.compare_exchange_strong(expected, true))
+        {
+            m_pJobThread->Schedule(this);
+        }
+    }
+
+    const int32_t released = releaseSelf ? 2 : 1;
+    return m_refCount.fetch_sub(released) == released;
+}
+
+bool JobObject::ReleaseRef()
+{
+    return m_refCount.fetch_sub(1) == 1;
+}
+
+void JobObject::Release(JobObject* obj)
+{
+    if (obj->ReleaseRef())
+    {
+        delete obj;
+    }
+}
+
+JobObject* JobObject::GetCurrent()
+{
+    return t_currentJobObject;
+}
+
+bool JobObject::PostJobAfter(std::chrono::milliseconds delay, Job job)
+{
+    if (m_markedForDelete.load())
+    {
+        return false;
+    }
+
+    TimerNode* node = TimerWheel::AllocNode();
+    node->job = std::move(job);
+    node->expireAt = TimerNode::Clock::now() + delay;
+    node->interval = std::chrono::milliseconds{0};
+    node->id = 0;
+    ScheduleTimer(node);
+    return true;
+}
+
+JobObject::TimerId JobObject::PostRepeatingJob(std::chrono::milliseconds interval, Job job)
+{
+    if (m_markedForDelete.load() || interval.count() <= 0)
+    {
+        return 0;
+    }
+
+    const TimerId id = ++m_lastTimerId;
+    m_repeatingTimers.push_back(id);
+
+    TimerNode* node = TimerWheel::AllocNode();
+    node->job = std::move(job);
+    node->expireAt = TimerNode::Clock::now() + interval;
+    node->interval = interval;
+    node->id = id;
+    ScheduleTimer(node);
+    return id;
+}
+
+bool JobObject::CancelTimer(TimerId id)
+{
+    // 노드는 건드리지 않고 살아있는 목록에서만 제거 (다음 만료 때 RunTimer가 반납)
+    auto it = std::find(m_repeatingTimers.begin(), m_repeatingTimers.end(), id);
+    if (it == m_repeatingTimers.end())
+    {
+        return false;
+    }
+
+    *it = m_repeatingTimers.back();
+    m_repeatingTimers.pop_back();
+    return true;
+}
+
+bool JobObject::IsRepeatingTimerAlive(TimerId id) const
+{
+    return std::find(m_repeatingTimers.begin(), m_repeatingTimers.end(), id) != m_repeatingTimers.end();
+}
+
+void JobObject::ScheduleTimer(TimerNode* node)
+{
+    m_refCount.fetch_add(1);
+    node->owner = this;
+    m_pJobThread->AddTimer(node);
+}
+
+void JobObject::FireTimer(TimerNode* node)
+{
+    // 삭제 마킹으로 거부되면 TimerFire 소멸자가 노드 반납
+    node->owner->PostJob(TimerFire(node));
+}
+
+void JobObject::ReleaseTimer(TimerNode* node)
+{
+    JobObject* owner = node->owner;
+    TimerWheel::FreeNode(node);
+    Release(owner);
+}
+
+void JobObject::ReleaseOnJobThread(JobObject* obj)
+{
+    // 참조를 빈 1회성 타이머 노드로 넘김 (ScheduleTimer와 달리 참조를 새로 잡지 않음)
+    // 다음 틱에 발사되어 실행되든 거부되든 ReleaseTimer가 obj의 스레드에서 참조를 놓음
+    TimerNode* node = TimerWheel::AllocNode();
+    node->job = []() {};
+    node->owner = obj;
+    node->expireAt = TimerNode::Clock::now();
+    obj->m_pJobThread->AddTimer(node);
+}
+
+void JobObject::RunTimer(TimerNode* node)
+{
+    const bool repeating = node->interval.count() > 0;
+    if (repeating && !IsRepeatingTimerAlive(node->id))
+    {
+        ReleaseTimer(node);
+        return;
+    }
+
+    node->job();
+
+    // Job 안에서 취소 / 삭제 마킹 / 스레드 이동이 있었을 수 있음
+    if (repeating && IsRepeatingTimerAlive(node->id))
+    {
+        if (!m_markedForDelete.load())
+        {
+            // 고정 간격 (밀렸으면 몰아서 실행하지 않고 지금부터 다시)
+            const auto now = TimerNode::Clock::now();
+            node->expireAt += node->interval;
+            if (node->expireAt <= now)
+            {
+                node->expireAt = now + node->interval;
+            }
+            m_pJobThread->AddTimer(node);
+            return;
+        }
+        CancelTimer(node->id);
+    }
+
+    ReleaseTimer(node);
+}
+
+void JobObject::SetJobThread(JobThreadBase* thread)
 {
     if (thread == nullptr)
     {
@@ -61,43 +347,96 @@ void JobObject::SetJobThread(JobThread* thread)
     m_pJobThread = thread;
 }
 
-void JobObject::Flush()
+JobFlushResult JobObject::Flush(const JobFlushBudget& budget)
 {
 	if (m_markedForDelete.load())
 	{
-		return;
+		return JobFlushResult::Deleted;
 	}
 
-    JobThread* pOldThread = m_pJobThread;
+    JobThreadBase* pOldThread = m_pJobThread;
+    CurrentJobObjectScope current(this);
+
+    // 계측은 Flush 단위로 켜고 끔 (대기 Job 수는 시각이 기록된 Job만 셈)
+    FlushStatsRecorder stats;
+    const bool instrumented = JobStats::IsEnabled();
+    if (instrumented)
+    {
+        if (m_typeStats == nullptr)
+        {
+            m_typeStats = JobStats::GetTypeCounters(typeid(*this));
+        }
+        stats.Begin(m_typeStats, &pOldThread->GetJobStats(), m_stampedJobs.load(std::memory_order_relaxed));
+    }
+
+    // 시간 예산이 있을 때만 시계 조회
+    const bool timed = budget.maxTime.count() > 0;
+    const auto deadline = timed ? std::chrono::steady_clock::now() + budget.maxTime : std::chrono::steady_clock::time_point{};
+    uint32_t executed = 0;
 
-    Job job;
-    while (m_jobQueue.Dequeue(&job))
+    while (JobNode* node = m_jobQueue.Dequeue())
     {
-		job();
+        if (node->enqueueStamp != 0)
+        {
+            m_stampedJobs.fetch_sub(1, std::memory_order_relaxed);
+            if (instrumented)
+            {
+                stats.BeforeJob(node->enqueueStamp);
+            }
+        }
+
+		node->job();
+        FreeJobNode(node);
+
+        if (instrumented)
+        {
+            stats.AfterJob();
+        }
 
         if (m_markedForDelete.load())
         {
-            return;
+            return JobFlushResult::Deleted;
         }
 
         // 스레드가 변경되었다면
         if (m_pJobThread != pOldThread)
         {
             // 새 스레드에 등록하고 종료
-            m_pJobThread->GetJobQueue()->Enqueue(this);
-            return;
+            m_pJobThread->Schedule(this);
+            return JobFlushResult::Released;
+        }
+
+        // 예산 소진: 남은 Job이 있으면 스케줄을 쥔 채로 양보
+        // 소비자 기준으로 확인 (IsEmpty는 마지막 노드를 꺼내는 중 끼어든 Job을 놓칠 수 있음)
+        executed++;
+        if ((budget.maxJobs != 0 && executed >= budget.maxJobs) ||
+            (timed && std::chrono::steady_clock::now() >= deadline))
+        {
+            if (m_jobQueue.HasPending())
+            {
+                return JobFlushResult::Yielded;
+            }
+            break;
         }
     }
 
+    // 여기까지 오면 소비자 기준으로 큐가 비어 있음 (Dequeue가 nullptr 또는 HasPending() == false)
+    // 스케줄을 놓는 순간 풀의 다른 워커가 잡아 삭제까지 할 수 있으므로 재확인이 끝날 때까지 참조 유지
+    // (삭제 쪽 ReleaseForDelete가 마지막 참조가 아니게 되어 아래 Release에서 delete)
+    AddRef();
     m_processing.store(false);
 
-    // Lost Wakeup 방지
-    if (m_jobQueue.GetUseCount() > 0)
+    // Lost Wakeup 방지: 위 확인 이후 들어온 Job은 head를 바꾸므로 IsEmpty로 충분
+    // 다른 워커가 삭제 처리 중이면 m_processing이 true로 남아 있어 CAS 실패
+    if (!m_jobQueue.IsEmpty())
     {
         bool expected = false;
         if (m_processing.compare_exchange_strong(expected, true))
         {
-            m_pJobThread->GetJobQueue()->Enqueue(this);
+            m_pJobThread->Schedule(this);
         }
     }
+
+    Release(this);
+    return JobFlushResult::Released;
 }
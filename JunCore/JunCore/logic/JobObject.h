@@ -1,32 +1,75 @@
 ﻿#pragma once
-#include "../../JunCommon/container/LFQueue.h"
-#include <functional>
+#include "../../JunCommon/container/MPSCQueue.h"
+#include "Job.h"
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
 
-class JobThread;
+class JobThreadBase;
+struct JobStatsCounters;
+struct TimerNode;
+struct JobSwitchAwaiter;
+template <typename F> class JobCallAwaiter;
+template <typename T> class LFObjectPoolTLS;
 
 //------------------------------
-// Job - 처리할 작업 단위
+// Flush 1회당 실행 예산 (JobThread::SetFlushBudget)
+// 한 JobObject에 Job이 몰려도 같은 스레드의 다른 JobObject / FixedUpdate가 밀리지 않게 함
+// 0 = 제한 없음
 //------------------------------
-using Job = std::function<void()>;
+struct JobFlushBudget
+{
+    uint32_t maxJobs = 0;
+    std::chrono::microseconds maxTime{0};
+};
+
+enum class JobFlushResult
+{
+    Released,   // 큐를 비우고 스케줄 해제 (또는 다른 스레드로 이동) - 이후 접근 금지
+    Yielded,    // 예산 소진, 스케줄 유지 중 - 호출자가 스레드 큐 뒤로 재스케줄
+    Deleted,    // 삭제 마킹 - 호출자가 delete
+};
 
 //------------------------------
 // JobObject - Job을 받아서 처리하는 객체
 // Player, Monster, GameObjectManager 등이 상속
 // JobThread (또는 GameThread)에서 Flush됨
+// MPSCQueueNode: JobThread 스케줄 큐의 침습형 링크 (m_processing으로 한 번에 한 큐에만 존재)
 //------------------------------
-class JobObject
+class JobObject : public MPSCQueueNode
 {
 protected:
-    LFQueue<Job> m_jobQueue;
+    // Job 노드는 생산자 스레드별 TLS 풀에서 할당 (IOCP 워커 간 풀 CAS 경합 없음)
+    struct JobNode : MPSCQueueNode
+    {
+        Job job;
+        int64_t enqueueStamp = 0;     // JobStats 켜진 상태로 PostJob된 경우만 (ns)
+    };
+
+    MPSCQueue<JobNode> m_jobQueue;    // 단일 소비자 (Flush는 한 번에 한 스레드)
     std::atomic<bool> m_processing{false};
     std::atomic<bool> m_markedForDelete{false};
-    JobThread* m_pJobThread;
+    JobThreadBase* m_pJobThread;
+
+    // 참조 수: 자기 자신 1 + 대기 중인 타이머 노드 수 + 스케줄 해제 후 재확인 중인 Flush (0으로 만든 쪽이 delete)
+    // 삭제 마킹 후에도 휠에 남은 타이머가 만료될 때까지 메모리는 유지됨
+    std::atomic<int32_t> m_refCount{1};
+    bool m_deleteReleased = false;  // ReleaseForDelete가 자기 참조를 놓았는지 (스케줄을 쥔 스레드만 접근)
+
+    // 살아있는 반복 타이머 (이 JobObject의 Job 안에서만 접근)
+    std::vector<uint64_t> m_repeatingTimers;
+    uint64_t m_lastTimerId = 0;
+
+    // JobStats 계측 (enqueueStamp가 있는 Job 수 / 타입 카운터 캐시는 Flush 스레드 전용)
+    std::atomic<int32_t> m_stampedJobs{0};
+    JobStatsCounters* m_typeStats = nullptr;
 
 public:
     // 기본 생성자 (싱글톤 패턴용 - Initialize에서 JobThread 설정 필수)
     JobObject();
-    explicit JobObject(JobThread* jobThread);
+    explicit JobObject(JobThreadBase* jobThread);
     virtual ~JobObject();
 
     //------------------------------
@@ -35,11 +78,45 @@ public:
     //------------------------------
     bool PostJob(Job job);
 
+    //------------------------------
+    // 지연 Job (아무 스레드에서 호출 가능)
+    // delay 후 이 JobObject의 큐로 들어가 일반 Job과 같은 순서 보장 속에서 실행
+    // 대기 중에는 JobThread 타이밍 휠에만 존재 (틱마다 폴링하지 않음)
+    // 취소가 필요하면 Job 안에서 세대 값 등으로 직접 확인
+    //------------------------------
+    bool PostJobAfter(std::chrono::milliseconds delay, Job job);
+
+    //------------------------------
+    // 반복 Job (이 JobObject의 Job 안에서만 호출)
+    // interval마다 실행, CancelTimer 또는 삭제 마킹까지 반복
+    // 실패(삭제 마킹) 시 0 반환
+    //------------------------------
+    using TimerId = uint64_t;
+    TimerId PostRepeatingJob(std::chrono::milliseconds interval, Job job);
+    bool CancelTimer(TimerId id);
+
+    //------------------------------
+    // 코루틴 (JobTask.h에 정의, JobTask 코루틴 안에서 co_await)
+    // Switch: 이후 코드를 이 JobObject의 Job으로 이어서 실행
+    // Call: fn을 이 JobObject의 Job으로 실행하고 결과를 들고 호출한 JobObject로 복귀
+    // 대상이 삭제 마킹되어 Job이 버려지면 코루틴은 재개되지 않고 프레임이 파괴됨
+    //------------------------------
+    JobSwitchAwaiter Switch();
+
+    template<typename F>
+    JobCallAwaiter<std::decay_t<F>> Call(F&& fn);
+
+    // 현재 스레드에서 Flush 중인 JobObject (Job 밖이면 nullptr)
+    static JobObject* GetCurrent();
+
     //------------------------------
     // Job 처리 (JobThread에서 호출)
     // Lost Wakeup 방지 로직 포함
+    // 예산을 넘기면 남은 Job은 두고 Yielded 반환 (m_processing 유지)
+    // Released면 이미 스케줄이 풀려 다른 워커가 잡았을 수 있으므로 이후 접근 금지
+    // (Flush 자신도 스케줄을 놓은 뒤의 재확인은 참조를 잡은 채로 함)
     //------------------------------
-    void Flush();
+    JobFlushResult Flush(const JobFlushBudget& budget = JobFlushBudget{});
 
     //------------------------------
     // 삭제 마킹 (이후 PostJob 거부됨)
@@ -50,6 +127,37 @@ public:
     //------------------------------
     // JobThread 관리
     //------------------------------
-    JobThread* GetJobThread() { return m_pJobThread; }
-    void SetJobThread(JobThread* thread);
+    JobThreadBase* GetJobThread() { return m_pJobThread; }
+    void SetJobThread(JobThreadBase* thread);
+
+    //------------------------------
+    // 삭제 (Flush가 Deleted를 반환한 뒤 JobThread에서 호출)
+    // 남은 Job을 버리고 자기 참조를 놓음, 대기 중인 타이머가 없으면 true (호출자가 delete)
+    // 스케줄도 놓으므로 이후 늦게 들어온 Job은 재스케줄되어 다시 이 경로로 버려짐
+    //------------------------------
+    bool ReleaseForDelete();
+
+    //------------------------------
+    // 타이머 (JobThread 타이밍 휠에서 호출)
+    // FireTimer: 만료된 노드를 owner의 Job으로 넣음 (거부되면 노드 반납)
+    // ReleaseTimer: 노드 반납 + owner 참조 해제 (마지막 참조면 owner delete)
+    //------------------------------
+    static void FireTimer(TimerNode* node);
+    static void ReleaseTimer(TimerNode* node);
+
+private:
+    template <typename F> friend class JobCallAwaiter;
+    struct TimerFire;
+
+    void ScheduleTimer(TimerNode* node);
+    void RunTimer(TimerNode* node);
+    bool IsRepeatingTimerAlive(TimerId id) const;
+    bool ReleaseRef();
+    void AddRef() { m_refCount.fetch_add(1); }
+    static void Release(JobObject* obj);    // 참조 해제 + 마지막 참조면 delete
+    static void ReleaseOnJobThread(JobObject* obj);    // 참조를 obj의 JobThread로 넘겨 그 스레드에서 Release
+
+    static LFObjectPoolTLS<JobNode>& GetJobNodePool();
+    static JobNode* AllocJobNode(Job&& job);
+    static void FreeJobNode(JobNode* node);
 };
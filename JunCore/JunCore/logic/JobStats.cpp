@@ -0,0 +1,52 @@
+﻿#include "JobStats.h"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <typeindex>
+
+namespace
+{
+    struct TypeRegistry
+    {
+        std::mutex lock;
+        std::map<std::type_index, std::unique_ptr<JobStatsCounters>> counters;
+    };
+
+    // 종료 시점 싱글톤 JobObject가 캐시한 포인터를 쓸 수 있으므로 해제하지 않음
+    TypeRegistry& GetRegistry()
+    {
+        static auto* registry = new TypeRegistry();
+        return *registry;
+    }
+}
+
+JobStatsCounters* JobStats::GetTypeCounters(const std::type_info& type)
+{
+    TypeRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+
+    std::unique_ptr<JobStatsCounters>& counters = registry.counters[std::type_index(type)];
+    if (!counters)
+    {
+        counters = std::make_unique<JobStatsCounters>();
+    }
+    return counters.get();
+}
+
+std::vector<JobStats::TypeSnapshot> JobStats::TakeTypeSnapshots()
+{
+    TypeRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+
+    std::vector<TypeSnapshot> snapshots;
+    for (auto& [type, counters] : registry.counters)
+    {
+        JobStatsCounters::Snapshot stats = counters->TakeSnapshot();
+        if (stats.jobsPerFlush.count == 0)
+        {
+            continue;
+        }
+        snapshots.push_back(TypeSnapshot{ type.name(), std::move(stats) });
+    }
+    return snapshots;
+}
@@ -0,0 +1,91 @@
+﻿#pragma once
+#include "../../JunCommon/timer/LatencyHistogram.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+//------------------------------
+// Job 처리 계측 묶음 (JobObject 타입별 / JobThread별 하나)
+// - waitUs: PostJob -> 실행 시작
+// - runUs: Job 1개 실행 시간
+// - jobsPerFlush: Flush 1회에 실행한 Job 수
+// - queueDepth: Flush 시작 시 대기 중이던 Job 수
+//------------------------------
+struct JobStatsCounters
+{
+    struct Snapshot
+    {
+        LatencyHistogram::Snapshot waitUs;
+        LatencyHistogram::Snapshot runUs;
+        LatencyHistogram::Snapshot jobsPerFlush;
+        LatencyHistogram::Snapshot queueDepth;
+
+        void Merge(const Snapshot& other)
+        {
+            waitUs.Merge(other.waitUs);
+            runUs.Merge(other.runUs);
+            jobsPerFlush.Merge(other.jobsPerFlush);
+            queueDepth.Merge(other.queueDepth);
+        }
+    };
+
+    LatencyHistogram waitUs;
+    LatencyHistogram runUs;
+    LatencyHistogram jobsPerFlush;
+    LatencyHistogram queueDepth;
+
+    Snapshot TakeSnapshot()
+    {
+        return Snapshot{ waitUs.TakeSnapshot(), runUs.TakeSnapshot(), jobsPerFlush.TakeSnapshot(), queueDepth.TakeSnapshot() };
+    }
+};
+
+//------------------------------
+// JobStats - Job 시스템 계측 스위치 + JobObject 타입별 집계
+//
+// 기본 꺼짐 (SetEnabled). 꺼져 있으면 PostJob / Flush당 relaxed load 1회만 추가됨
+// 켜면 PostJob마다 시각 기록, Job마다 시계 조회 1회
+// 타입 카운터는 JobObject가 처음 계측될 때 1회 조회 후 캐시 (락은 그때만)
+//------------------------------
+class JobStats
+{
+public:
+    struct TypeSnapshot
+    {
+        std::string typeName;
+        JobStatsCounters::Snapshot stats;
+    };
+
+public:
+    static void SetEnabled(bool enable) { s_enabled.store(enable, std::memory_order_relaxed); }
+    static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+    // 계측용 시각 (ns, 0은 "기록 안 됨" 표시로 사용)
+    static int64_t Now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // 타입별 카운터 (프로세스 종료까지 유지)
+    static JobStatsCounters* GetTypeCounters(const std::type_info& type);
+
+    // 타입별 누적값을 꺼내고 초기화 (구간 동안 Flush가 없었던 타입은 제외)
+    static std::vector<TypeSnapshot> TakeTypeSnapshots();
+
+private:
+    static inline std::atomic<bool> s_enabled{false};
+};
+
+//------------------------------
+// 수집 결과 묶음 (Server::TakeJobStats)
+//------------------------------
+struct JobStatsReport
+{
+    JobStatsCounters::Snapshot coreThread;
+    std::vector<JobStatsCounters::Snapshot> gameThreads;
+    std::vector<JobStats::TypeSnapshot> types;
+};
@@ -0,0 +1,51 @@
+﻿#include "JobTask.h"
+#include "../../JunCommon/pool/LFObjectPool.h"
+
+namespace
+{
+    //------------------------------
+    // 코루틴 프레임 풀 (256 / 1024 바이트 등급, 초과분은 new)
+    // Job 외부 블록 풀과 같은 이유로 해제하지 않음
+    //------------------------------
+    template<size_t N>
+    struct alignas(std::max_align_t) FrameBlock
+    {
+        unsigned char bytes[N];
+    };
+
+    template<size_t N>
+    LFObjectPool<FrameBlock<N>>& FramePool()
+    {
+        static auto* pool = new LFObjectPool<FrameBlock<N>>();
+        return *pool;
+    }
+}
+
+void* JobTask::promise_type::operator new(size_t size)
+{
+    if (size <= 256)
+    {
+        return FramePool<256>().Alloc();
+    }
+    if (size <= 1024)
+    {
+        return FramePool<1024>().Alloc();
+    }
+    return ::operator new(size);
+}
+
+void JobTask::promise_type::operator delete(void* frame, size_t size) noexcept
+{
+    if (size <= 256)
+    {
+        FramePool<256>().Free(static_cast<FrameBlock<256>*>(frame));
+    }
+    else if (size <= 1024)
+    {
+        FramePool<1024>().Free(static_cast<FrameBlock<1024>*>(frame));
+    }
+    else
+    {
+        ::operator delete(frame);
+    }
+}
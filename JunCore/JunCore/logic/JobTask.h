@@ -0,0 +1,270 @@
+﻿#pragma once
+#include "JobObject.h"
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+//------------------------------
+// JobTask - JobObject 스레드에서 이어 실행되는 코루틴 (발사 후 망각)
+//
+// 중첩 PostJob 람다 대신 한 함수 안에서 여러 JobObject를 오가는 흐름을 작성
+//
+//   JobTask Player::EnterWorld(GameScene* scene)
+//   {
+//       co_await DelayFor(std::chrono::milliseconds(100));   // 이 Player 스레드에서 재개
+//       bool ok = co_await other->Call([other]() { return other->Check(); });
+//       co_await Switch();                                   // 호출자가 Job 밖이었다면 여기서 합류
+//       ...
+//   }
+//
+// - 호출 즉시 첫 co_await까지 호출 스레드에서 실행, 끝나면 프레임 자동 해제
+// - 재개는 항상 해당 JobObject의 Job으로 (같은 JobObject의 다른 Job과 직렬)
+// - 재개 Job이 버려지면 (대상 삭제 마킹 등) 코루틴은 거기서 끝남: 지역 변수 소멸자만 실행
+// - 프레임은 크기 등급별 LFObjectPool 블록 (재개 스레드가 바뀌므로 TLS 풀 아님)
+// - Call의 fn이 던진 예외는 호출자 쪽 co_await에서 다시 던짐
+// - 코루틴 밖으로 나간 예외는 일반 Job과 마찬가지로 복구하지 않음 (terminate)
+//------------------------------
+class JobTask
+{
+public:
+    struct promise_type
+    {
+        JobTask get_return_object() noexcept { return JobTask{}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+
+        static void* operator new(size_t size);
+        static void operator delete(void* frame, size_t size) noexcept;
+    };
+};
+
+//------------------------------
+// 코루틴 재개 Job
+// 실행되지 못하고 버려지면 소멸자에서 프레임 파괴
+//------------------------------
+class JobResume
+{
+public:
+    explicit JobResume(std::coroutine_handle<> handle) noexcept : m_handle(handle) {}
+    JobResume(JobResume&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+    JobResume& operator=(JobResume&&) = delete;
+
+    ~JobResume()
+    {
+        if (m_handle)
+        {
+            m_handle.destroy();
+        }
+    }
+
+    void operator()()
+    {
+        std::exchange(m_handle, nullptr).resume();
+    }
+
+private:
+    std::coroutine_handle<> m_handle;
+};
+
+//------------------------------
+// co_await obj->Switch()
+// 이미 obj의 Job 안이면 중단 없이 진행
+//------------------------------
+struct JobSwitchAwaiter
+{
+    JobObject* target;
+
+    bool await_ready() const noexcept { return JobObject::GetCurrent() == target; }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        // 성공하면 다른 스레드가 바로 재개할 수 있으므로 이후 this(프레임 안) 접근 금지
+        target->PostJob(JobResume(handle));
+    }
+
+    void await_resume() const noexcept {}
+};
+
+inline JobSwitchAwaiter JobObject::Switch()
+{
+    return JobSwitchAwaiter{ this };
+}
+
+//------------------------------
+// co_await DelayFor(delay)
+// 현재 JobObject의 타이머로 재개 (JobObject의 Job 안에서만 사용)
+//------------------------------
+struct JobDelayAwaiter
+{
+    std::chrono::milliseconds delay;
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        JobObject* current = JobObject::GetCurrent();
+        if (current == nullptr)
+        {
+            throw std::logic_error("DelayFor: must be awaited inside a JobObject job");
+        }
+        current->PostJobAfter(delay, JobResume(handle));
+    }
+
+    void await_resume() const noexcept {}
+};
+
+inline JobDelayAwaiter DelayFor(std::chrono::milliseconds delay)
+{
+    return JobDelayAwaiter{ delay };
+}
+
+//------------------------------
+// co_await target->Call(fn)
+// fn을 target의 Job으로 실행 -> 결과(또는 예외)를 프레임에 저장 -> 호출한 JobObject의 Job으로 재개
+// 호출자가 JobObject의 Job 밖이면 target 스레드에서 그대로 재개
+// 대기 중 호출자가 삭제되지 않도록 참조 1개 보유
+// 참조는 재개 Job과 함께 호출자에게 돌아가 호출자 스레드에서 놓음
+// (재개 Job이 거부 / 폐기되면 호출자 JobThread로 넘겨 놓음 -> 호출자 delete가 target 스레드에서 일어나지 않음)
+//------------------------------
+template<typename F>
+class JobCallAwaiter
+{
+public:
+    using Result = std::invoke_result_t<F&>;
+    static_assert(!std::is_reference_v<Result>, "JobObject::Call: return by value");
+
+public:
+    JobCallAwaiter(JobObject* target, F fn) : m_target(target), m_fn(std::move(fn)) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        JobObject* caller = JobObject::GetCurrent();
+        if (caller != nullptr)
+        {
+            caller->AddRef();
+        }
+        m_target->PostJob(CallJob(this, caller, handle));
+    }
+
+    Result await_resume()
+    {
+        if (m_error)
+        {
+            std::rethrow_exception(m_error);
+        }
+        if constexpr (!std::is_void_v<Result>)
+        {
+            return std::move(*m_result);
+        }
+    }
+
+private:
+    //------------------------------
+    // 호출자 큐로 돌아가는 재개 Job (호출자 참조를 들고 감)
+    //------------------------------
+    struct CallerResume
+    {
+        JobObject* caller;
+        JobResume resume;
+
+        CallerResume(JobObject* from, JobResume&& handle) noexcept : caller(from), resume(std::move(handle)) {}
+        CallerResume(CallerResume&& other) noexcept
+            : caller(std::exchange(other.caller, nullptr)), resume(std::move(other.resume))
+        {
+        }
+
+        ~CallerResume()
+        {
+            // 실행되지 못함 (PostJob 거부 또는 호출자 삭제 시 폐기)
+            if (caller != nullptr)
+            {
+                JobObject::ReleaseOnJobThread(caller);
+            }
+        }
+
+        void operator()()
+        {
+            // 호출자 Flush 안이므로 자기 참조가 남아 있어 여기서 마지막 참조가 되지 않음
+            JobObject* from = std::exchange(caller, nullptr);
+            resume();
+            JobObject::Release(from);
+        }
+    };
+
+    struct CallJob
+    {
+        JobCallAwaiter* awaiter;
+        JobObject* caller;
+        JobResume resume;
+
+        CallJob(JobCallAwaiter* owner, JobObject* from, std::coroutine_handle<> handle) noexcept
+            : awaiter(owner), caller(from), resume(handle)
+        {
+        }
+
+        CallJob(CallJob&& other) noexcept
+            : awaiter(other.awaiter), caller(std::exchange(other.caller, nullptr)), resume(std::move(other.resume))
+        {
+        }
+
+        ~CallJob()
+        {
+            // target 삭제로 폐기됨 (target 스레드)
+            if (caller != nullptr)
+            {
+                JobObject::ReleaseOnJobThread(caller);
+            }
+        }
+
+        void operator()()
+        {
+            try
+            {
+                if constexpr (std::is_void_v<Result>)
+                {
+                    awaiter->m_fn();
+                }
+                else
+                {
+                    awaiter->m_result.emplace(awaiter->m_fn());
+                }
+            }
+            catch (...)
+            {
+                awaiter->m_error = std::current_exception();
+            }
+
+            JobObject* from = std::exchange(caller, nullptr);
+            if (from == nullptr)
+            {
+                resume();
+                return;
+            }
+
+            // 거부되면 CallerResume 소멸자가 프레임 파괴 + 참조를 호출자 JobThread로, 이후 awaiter 접근 금지
+            from->PostJob(CallerResume(from, std::move(resume)));
+        }
+    };
+
+    struct Empty {};
+
+    JobObject* m_target;
+    F m_fn;
+    std::conditional_t<std::is_void_v<Result>, Empty, std::optional<Result>> m_result;
+    std::exception_ptr m_error;
+};
+
+template<typename F>
+JobCallAwaiter<std::decay_t<F>> JobObject::Call(F&& fn)
+{
+    return JobCallAwaiter<std::decay_t<F>>(this, std::forward<F>(fn));
+}
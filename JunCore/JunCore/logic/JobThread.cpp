@@ -1,10 +1,30 @@
 ﻿#include "JobThread.h"
 #include "JobObject.h"
+#include "../log.h"
 #include <chrono>
+#include <stdexcept>
+#include <typeinfo>
+
+JobThread::JobThread()
+{
+    // auto-reset: Wake 1회당 Park 1회 해제
+    m_wakeEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+    if (m_wakeEvent == NULL)
+    {
+        throw std::runtime_error("JobThread: CreateEvent failed");
+    }
+}
 
 JobThread::~JobThread()
 {
+    // 남은 타이머 반납(JobThreadBase 소멸자) 전에 스레드 정지
     Stop();
+
+    if (m_wakeEvent != NULL)
+    {
+        CloseHandle(m_wakeEvent);
+        m_wakeEvent = NULL;
+    }
 }
 
 void JobThread::Start()
@@ -16,6 +36,7 @@ void JobThread::Start()
 
     m_running.store(true);
     m_worker = std::thread([this]() {
+        ApplyPlacement();
         Run();
     });
 }
@@ -23,6 +44,7 @@ void JobThread::Start()
 void JobThread::Stop()
 {
     m_running.store(false);
+    SetEvent(m_wakeEvent);
 
     if (m_worker.joinable())
     {
@@ -34,24 +56,114 @@ void JobThread::Run()
 {
     while (m_running.load())
     {
-        ProcessJobObjects();
-        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        ProcessTimers();
+
+        if (ProcessJobObjects() == 0)
+        {
+            WaitForJobs();
+        }
     }
 
-    // 종료 전 남은 JobObject 모두 처리
-    ProcessJobObjects();
+    DrainJobObjects();
 }
 
-void JobThread::ProcessJobObjects()
+void JobThread::DrainJobObjects()
 {
-    JobObject* jobObj = nullptr;
-    while (m_jobObjectQueue.Dequeue(&jobObj))
+    // 예산으로 양보한 것까지 처리하되, 자기 자신에게 계속 PostJob하는 Job이 있으면 끝나지 않으므로 시간 상한
+    const JobFlushBudget budget = GetShutdownFlushBudget();
+    const auto start = std::chrono::steady_clock::now();
+    size_t passes = 0;
+
+    while (ProcessJobObjects(budget) > 0)
     {
-        jobObj->Flush();
+        passes++;
+        if (std::chrono::steady_clock::now() - start < SHUTDOWN_DRAIN_TIMEOUT)
+        {
+            continue;
+        }
 
-        if (jobObj->IsMarkedForDelete())
+        // 남은 JobObject 수 확인 (Flush하지 않고 큐에 그대로 되돌림)
+        while (JobObject* jobObj = m_jobObjectQueue.Dequeue())
+        {
+            m_yieldedJobObjects.push_back(jobObj);
+        }
+        if (!m_yieldedJobObjects.empty())
         {
-            delete jobObj;
+            LOG_WARN("JobThread: shutdown drain gave up after %zu passes, %zu JobObjects left undrained (first: %s)",
+                passes, m_yieldedJobObjects.size(), typeid(*m_yieldedJobObjects.front()).name());
         }
+        for (JobObject* jobObj : m_yieldedJobObjects)
+        {
+            m_jobObjectQueue.Enqueue(jobObj);
+        }
+        m_yieldedJobObjects.clear();
+        return;
     }
 }
+
+void JobThread::Schedule(JobObject* jobObject)
+{
+    m_jobObjectQueue.Enqueue(jobObject);
+
+    // Park 중일 때만 깨움 (처리 중인 스레드에 대한 PostJob은 시스템콜 없음)
+    // exchange로 여러 생산자가 동시에 깨우려 해도 SetEvent는 1회
+    if (m_parked.load() && m_parked.exchange(false))
+    {
+        SetEvent(m_wakeEvent);
+    }
+}
+
+void JobThread::WakeTimerThread()
+{
+    if (m_parked.load() && m_parked.exchange(false))
+    {
+        SetEvent(m_wakeEvent);
+    }
+}
+
+void JobThread::WaitForJobs()
+{
+    // 1. 스핀
+    const auto spinEnd = std::chrono::steady_clock::now() + IDLE_SPIN_DURATION;
+    do
+    {
+        if (m_jobObjectQueue.HasPending() || m_timerInbox.HasPending() || !m_running.load())
+        {
+            return;
+        }
+        YieldProcessor();
+    } while (std::chrono::steady_clock::now() < spinEnd);
+
+    // 2. Park
+    // Park 상태를 먼저 공개한 뒤 큐를 재확인 (Schedule의 Enqueue -> m_parked 확인 순서와 짝을 이뤄 Lost Wakeup 방지)
+    m_parked.store(true);
+    if (!m_jobObjectQueue.HasPending() && !m_timerInbox.HasPending() && m_running.load())
+    {
+        WaitForSingleObject(m_wakeEvent, GetParkTimeoutMs());
+    }
+    m_parked.store(false);
+}
+
+size_t JobThread::ProcessJobObjects(const JobFlushBudget& budget)
+{
+    size_t processed = 0;
+
+    while (JobObject* jobObj = m_jobObjectQueue.Dequeue())
+    {
+        if (FlushJobObject(jobObj, budget) == JobFlushResult::Yielded)
+        {
+            m_yieldedJobObjects.push_back(jobObj);
+        }
+        processed++;
+    }
+
+    // 양보한 JobObject는 이번 패스 중 들어온 JobObject 뒤로 (같은 패스에서 다시 잡지 않음)
+    // 자기 큐에 넣는 것이므로 Wake 불필요
+    for (JobObject* jobObj : m_yieldedJobObjects)
+    {
+        m_jobObjectQueue.Enqueue(jobObj);
+    }
+    m_yieldedJobObjects.clear();
+
+    return processed;
+}
@@ -1,49 +1,44 @@
 ﻿#pragma once
-#include "../../JunCommon/container/LFQueue.h"
+#include "JobThreadBase.h"
 #include <thread>
 #include <atomic>
-#include <functional>
-
-using Job = std::function<void()>;
-
-class JobObject;
+#include <vector>
 
 //------------------------------
-// JobThread - JobObject 처리 스레드 기반 클래스
+// JobThread - JobObject 처리 단일 스레드
 // GameThread가 상속하여 Scene Update 기능 추가
 // GameObjectManager 등 시스템 매니저들은 JobObject로 이 스레드 공유
 //------------------------------
-class JobThread
+class JobThread : public JobThreadBase
 {
 protected:
-    LFQueue<JobObject*> m_jobObjectQueue;
+    // 소비자는 이 스레드 하나 (JobObject가 MPSCQueueNode를 상속한 침습형 큐)
+    MPSCQueue<JobObject> m_jobObjectQueue;
 
     std::thread m_worker;
-    std::atomic<bool> m_running{false};
 
-public:
-    JobThread() = default;
-    virtual ~JobThread();
+    // 유휴 대기: 큐가 비면 잠깐 스핀 후 Park, Schedule이 Park 중일 때만 깨움
+    HANDLE m_wakeEvent = NULL;
+    std::atomic<bool> m_parked{false};
 
-    // 복사/이동 금지
-    JobThread(const JobThread&) = delete;
-    JobThread& operator=(const JobThread&) = delete;
+    // 이번 ProcessJobObjects 패스에서 예산을 소진한 JobObject (패스가 끝나면 큐 뒤로)
+    std::vector<JobObject*> m_yieldedJobObjects;
 
-    //------------------------------
-    // JobObject 큐 접근 (JobObject::PostJob에서 사용)
-    //------------------------------
-    LFQueue<JobObject*>* GetJobQueue() { return &m_jobObjectQueue; }
+public:
+    JobThread();
+    ~JobThread() override;
 
     //------------------------------
-    // 스레드 시작/종료
+    // JobObject 스케줄 (override)
+    // 큐에 넣고, 스레드가 Park 상태면 깨움
     //------------------------------
-    virtual void Start();
-    virtual void Stop();
+    void Schedule(JobObject* jobObject) override;
 
     //------------------------------
-    // 상태 확인
+    // 스레드 시작/종료 (override)
     //------------------------------
-    bool IsRunning() const { return m_running.load(); }
+    void Start() override;
+    void Stop() override;
 
 protected:
     //------------------------------
@@ -53,6 +48,25 @@ protected:
 
     //------------------------------
     // JobObject 처리 (GameThread에서도 호출)
+    // 큐에 있는 JobObject를 예산 내에서 한 번씩 Flush, 처리한 JobObject 수 반환
+    //------------------------------
+    size_t ProcessJobObjects() { return ProcessJobObjects(m_flushBudget); }
+    size_t ProcessJobObjects(const JobFlushBudget& budget);
+
+    //------------------------------
+    // 종료 처리 (Run 루프 종료 후 호출, GameThread도)
+    // 남은 JobObject를 SHUTDOWN_DRAIN_TIMEOUT 동안 처리하고, 시간 안에 비지 못하면 남은 수를 로그로 남기고 포기
+    //------------------------------
+    void DrainJobObjects();
+
+    //------------------------------
+    // 타이머 휠을 도는 이 스레드 깨우기 (override)
+    //------------------------------
+    void WakeTimerThread() override;
+
+    //------------------------------
+    // 유휴 대기 (Run에서 큐가 비었을 때 호출)
+    // 스핀 구간 동안 새 JobObject가 없으면 Schedule/Stop/타임아웃까지 Park
     //------------------------------
-    void ProcessJobObjects();
+    void WaitForJobs();
 };
@@ -0,0 +1,98 @@
+﻿#include "JobThreadBase.h"
+#include "JobObject.h"
+#include "../log.h"
+#include <chrono>
+
+JobThreadBase::~JobThreadBase()
+{
+    // 서브클래스 소멸자에서 스레드는 이미 정지
+    // 남은 타이머 반납 (owner 참조 해제, 삭제 대기 중이던 JobObject는 여기서 delete될 수 있음)
+    while (TimerNode* node = m_timerInbox.Dequeue())
+    {
+        JobObject::ReleaseTimer(node);
+    }
+    m_timerWheel.Clear([](TimerNode* node) { JobObject::ReleaseTimer(node); });
+}
+
+void JobThreadBase::SetPlacement(const ThreadPlacement& placement, int index)
+{
+    if (m_running.load())
+    {
+        LOG_WARN("JobThread::SetPlacement ignored: thread already running");
+        return;
+    }
+
+    m_placement = placement;
+    m_placementIndex = index;
+}
+
+void JobThreadBase::ApplyPlacement(int indexOffset)
+{
+    const int index = m_placementIndex + indexOffset;
+    if (!m_placement.ApplyToCurrentThread(index))
+    {
+        LOG_WARN("JobThread: failed to apply placement %s (index %d, error %d)", m_placement.ToString().c_str(), index, GetLastError());
+    }
+}
+
+void JobThreadBase::AddTimer(TimerNode* node)
+{
+    m_timerInbox.Enqueue(node);
+    WakeTimerThread();
+}
+
+void JobThreadBase::ProcessTimers()
+{
+    m_timerWheel.Advance(std::chrono::steady_clock::now(), [](TimerNode* node) {
+        JobObject::FireTimer(node);
+    });
+
+    // 수신함은 Advance 뒤에 옮김 (이미 지난 타이머는 다음 틱에 발사)
+    while (TimerNode* node = m_timerInbox.Dequeue())
+    {
+        m_timerWheel.Add(node);
+    }
+}
+
+DWORD JobThreadBase::GetParkTimeoutMs() const
+{
+    if (m_timerWheel.IsEmpty())
+    {
+        return PARK_TIMEOUT_MS;
+    }
+
+    // 가장 이른 타이머 만료까지 Park (PARK_TIMEOUT_MS 상한은 타이머가 없을 때와 같음)
+    const auto untilExpire = m_timerWheel.GetTimeToNextExpire(std::chrono::steady_clock::now());
+    const auto ms = std::chrono::ceil<std::chrono::milliseconds>(untilExpire).count();
+    return static_cast<DWORD>((std::min)(static_cast<int64_t>(PARK_TIMEOUT_MS), (std::max)(static_cast<int64_t>(ms), int64_t{1})));
+}
+
+JobFlushResult JobThreadBase::FlushJobObject(JobObject* jobObj, const JobFlushBudget& budget)
+{
+    // Flush가 스케줄을 놓은 뒤에는 다른 스레드가 이미 잡았을 수 있으므로
+    // 삭제 여부는 Flush 반환값으로만 판단
+    const JobFlushResult result = jobObj->Flush(budget);
+    if (result == JobFlushResult::Deleted)
+    {
+        // 휠에 남은 타이머가 있으면 마지막 타이머가 반납될 때 delete
+        if (jobObj->ReleaseForDelete())
+        {
+            delete jobObj;
+        }
+    }
+    else if (result == JobFlushResult::Yielded)
+    {
+        m_statBudgetExhausted.fetch_add(1, std::memory_order_relaxed);
+    }
+    return result;
+}
+
+JobFlushBudget JobThreadBase::GetShutdownFlushBudget() const
+{
+    JobFlushBudget budget = m_flushBudget;
+    if (budget.maxTime.count() == 0 || budget.maxTime > SHUTDOWN_FLUSH_MAX_TIME)
+    {
+        budget.maxTime = SHUTDOWN_FLUSH_MAX_TIME;
+    }
+    return budget;
+}
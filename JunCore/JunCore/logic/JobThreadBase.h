@@ -0,0 +1,140 @@
+﻿#pragma once
+#include "../../JunCommon/container/MPSCQueue.h"
+#include "../../JunCommon/system/ThreadPlacement.h"
+#include "JobObject.h"
+#include "JobStats.h"
+#include "TimerWheel.h"
+#include <atomic>
+#include <chrono>
+
+//------------------------------
+// JobThreadBase - JobObject 실행 스레드 공통 기반 (스레드 자체는 소유하지 않음)
+// JobThread(단일 스레드)와 JobThreadPool(워커 여러 개)이 상속
+// JobObject / GameObjectManager::Initialize는 이 타입으로 받으므로 둘 다 그대로 전달 가능
+//
+// - 배치 정책, Flush 예산, Job 계측, 타이머 휠/수신함을 공유
+// - 스레드 생성/대기/깨우기는 서브클래스 담당 (Schedule / Start / Stop / WakeTimerThread)
+// - 소멸자는 남은 타이머를 반납하므로 서브클래스 소멸자에서 먼저 Stop할 것
+//------------------------------
+class JobThreadBase
+{
+protected:
+    std::atomic<bool> m_running{false};
+
+    // Park 전 스핀 시간 (연달아 들어오는 Job에 대해 Park/Wake 시스템콜 회피)
+    static constexpr std::chrono::microseconds IDLE_SPIN_DURATION{50};
+
+    // Park 최대 대기 (Wake 누락 대비 안전망)
+    static constexpr DWORD PARK_TIMEOUT_MS = 100;
+
+    // 종료 시 남은 JobObject 처리 상한 (자기 자신에게 계속 PostJob하는 Job이 있어도 Stop이 끝나도록)
+    static constexpr std::chrono::milliseconds SHUTDOWN_DRAIN_TIMEOUT{1000};
+
+    // 종료 처리 중 Flush 1회 시간 상한 (예산 미설정이어도 JobObject 하나가 상한을 넘겨 붙잡지 못하게)
+    static constexpr std::chrono::microseconds SHUTDOWN_FLUSH_MAX_TIME{1000};
+
+    // CPU/NUMA 배치 (Start 전에 설정)
+    ThreadPlacement m_placement;
+    int m_placementIndex = 0;
+
+    // JobObject Flush 1회당 예산 (Start 전에 설정), 소진 횟수
+    JobFlushBudget m_flushBudget;
+    std::atomic<uint64_t> m_statBudgetExhausted{0};
+
+    // JobStats 켜진 동안 이 스레드에서 Flush된 Job 계측 (풀은 워커 전체 합산)
+    JobStatsCounters m_jobStats;
+
+    // 지연/반복 Job: 다른 스레드는 수신함에 넣고, 휠은 한 스레드만 만짐
+    TimerWheel m_timerWheel;
+    MPSCQueue<TimerNode> m_timerInbox;
+
+public:
+    JobThreadBase() = default;
+    virtual ~JobThreadBase();
+
+    // 복사/이동 금지
+    JobThreadBase(const JobThreadBase&) = delete;
+    JobThreadBase& operator=(const JobThreadBase&) = delete;
+
+    //------------------------------
+    // JobObject 스케줄 (JobObject::PostJob / Flush에서 사용)
+    // 큐에 넣고, 처리할 스레드가 Park 상태면 깨움
+    //------------------------------
+    virtual void Schedule(JobObject* jobObject) = 0;
+
+    //------------------------------
+    // 타이머 등록 (JobObject::PostJobAfter 등에서 사용, 아무 스레드)
+    // 수신함에 넣고, Park 중이면 깨워서 대기 시간을 다시 계산하게 함
+    //------------------------------
+    void AddTimer(TimerNode* node);
+
+    //------------------------------
+    // 스레드 시작/종료
+    //------------------------------
+    virtual void Start() = 0;
+    virtual void Stop() = 0;
+
+    //------------------------------
+    // CPU/NUMA 배치 (Start 전에 호출)
+    // index: 같은 정책을 공유하는 스레드 내 순번
+    //------------------------------
+    void SetPlacement(const ThreadPlacement& placement, int index = 0);
+    const ThreadPlacement& GetPlacement() const { return m_placement; }
+
+    //------------------------------
+    // JobObject Flush 예산 (Start 전에 호출, 기본값 제한 없음)
+    // 초과분은 스레드 큐 맨 뒤로 재스케줄되어 다음 패스(GameThread는 다음 프레임)에 이어서 처리
+    //------------------------------
+    void SetFlushBudget(const JobFlushBudget& budget) { m_flushBudget = budget; }
+    const JobFlushBudget& GetFlushBudget() const { return m_flushBudget; }
+
+    // 예산 소진으로 양보한 누적 횟수 (다른 스레드에서 조회 가능)
+    uint64_t GetBudgetExhaustedCount() const { return m_statBudgetExhausted.load(std::memory_order_relaxed); }
+
+    //------------------------------
+    // Job 계측 (JobStats::SetEnabled 동안만 기록)
+    // GetJobStats: JobObject::Flush가 기록, TakeJobStats: 누적값을 꺼내고 초기화 (아무 스레드)
+    //------------------------------
+    JobStatsCounters& GetJobStats() { return m_jobStats; }
+    JobStatsCounters::Snapshot TakeJobStats() { return m_jobStats.TakeSnapshot(); }
+
+    //------------------------------
+    // 상태 확인
+    //------------------------------
+    bool IsRunning() const { return m_running.load(); }
+
+protected:
+    //------------------------------
+    // 타이머 처리 (휠 담당 스레드가 루프마다 호출, GameThread는 프레임마다)
+    // 만료된 타이머를 owner JobObject의 Job으로 넣고 수신함을 휠로 옮김
+    //------------------------------
+    void ProcessTimers();
+
+    //------------------------------
+    // Park 최대 대기 (대기 중인 타이머가 있으면 다음 틱까지)
+    //------------------------------
+    DWORD GetParkTimeoutMs() const;
+
+    //------------------------------
+    // AddTimer 후 휠을 도는 스레드 깨우기 (JobThreadPool은 0번 워커)
+    //------------------------------
+    virtual void WakeTimerThread() = 0;
+
+    //------------------------------
+    // JobObject 하나 Flush + 삭제 마킹 시 delete
+    // Yielded면 호출자가 재스케줄
+    //------------------------------
+    JobFlushResult FlushJobObject(JobObject* jobObj) { return FlushJobObject(jobObj, m_flushBudget); }
+    JobFlushResult FlushJobObject(JobObject* jobObj, const JobFlushBudget& budget);
+
+    //------------------------------
+    // 종료 처리용 Flush 예산 (설정된 예산에 SHUTDOWN_FLUSH_MAX_TIME 상한 추가)
+    //------------------------------
+    JobFlushBudget GetShutdownFlushBudget() const;
+
+    //------------------------------
+    // 배치 정책 적용 (스레드 시작 직후 호출)
+    // indexOffset: 여러 스레드를 가진 서브클래스(JobThreadPool)의 스레드 순번
+    //------------------------------
+    void ApplyPlacement(int indexOffset = 0);
+};
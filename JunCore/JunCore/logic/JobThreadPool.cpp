@@ -0,0 +1,243 @@
+﻿#include "JobThreadPool.h"
+#include "JobObject.h"
+#include "../log.h"
+#include <stdexcept>
+#include <chrono>
+
+thread_local JobThreadPool* JobThreadPool::t_pool = nullptr;
+thread_local int JobThreadPool::t_workerIndex = -1;
+
+JobThreadPool::JobThreadPool(int workerCount)
+{
+    if (workerCount < 1)
+    {
+        throw std::invalid_argument("JobThreadPool: workerCount must be positive");
+    }
+
+    m_workers.reserve(workerCount);
+    for (int i = 0; i < workerCount; ++i)
+    {
+        auto worker = std::make_unique<Worker>();
+        worker->wakeEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+        if (worker->wakeEvent == NULL)
+        {
+            throw std::runtime_error("JobThreadPool: CreateEvent failed");
+        }
+        m_workers.push_back(std::move(worker));
+    }
+}
+
+JobThreadPool::~JobThreadPool()
+{
+    // 남은 타이머 반납(JobThreadBase 소멸자) 전에 워커 정지
+    Stop();
+
+    for (auto& worker : m_workers)
+    {
+        CloseHandle(worker->wakeEvent);
+        worker->wakeEvent = NULL;
+    }
+}
+
+void JobThreadPool::Start()
+{
+    if (m_running.load())
+    {
+        return;
+    }
+
+    m_running.store(true);
+    for (int i = 0; i < static_cast<int>(m_workers.size()); ++i)
+    {
+        m_workers[i]->thread = std::thread([this, i]() {
+            ApplyPlacement(i);
+            WorkerRun(i);
+        });
+    }
+}
+
+void JobThreadPool::Stop()
+{
+    m_running.store(false);
+
+    for (auto& worker : m_workers)
+    {
+        SetEvent(worker->wakeEvent);
+    }
+
+    for (auto& worker : m_workers)
+    {
+        if (worker->thread.joinable())
+        {
+            worker->thread.join();
+        }
+    }
+}
+
+void JobThreadPool::Schedule(JobObject* jobObject)
+{
+    int index = t_workerIndex;
+    if (t_pool != this)
+    {
+        index = static_cast<int>(m_nextWorker.fetch_add(1, std::memory_order_relaxed) % m_workers.size());
+    }
+
+    Worker& worker = *m_workers[index];
+    worker.queue.Enqueue(jobObject);
+
+    if (worker.parked.load() && worker.parked.exchange(false))
+    {
+        SetEvent(worker.wakeEvent);
+        return;
+    }
+
+    // 대상 워커가 처리 중이면 쉬고 있는 워커에게 넘김
+    if (m_parkedCount.load() > 0)
+    {
+        WakeIdleWorker(index);
+    }
+}
+
+void JobThreadPool::WakeIdleWorker(int skipIndex)
+{
+    const int count = static_cast<int>(m_workers.size());
+    for (int i = 1; i < count; ++i)
+    {
+        Worker& worker = *m_workers[(skipIndex + i) % count];
+        if (worker.parked.load() && worker.parked.exchange(false))
+        {
+            SetEvent(worker.wakeEvent);
+            return;
+        }
+    }
+}
+
+void JobThreadPool::WorkerRun(int index)
+{
+    t_pool = this;
+    t_workerIndex = index;
+
+    // 타이머 휠은 0번 워커 전용
+    const bool timerWorker = (index == 0);
+
+    JobObject* jobObj = nullptr;
+    while (m_running.load())
+    {
+        if (timerWorker)
+        {
+            ProcessTimers();
+        }
+
+        if (TryPop(index, &jobObj))
+        {
+            // 예산 소진 시 자기 큐 뒤로 (쉬는 워커가 있으면 깨워서 가져가게 함)
+            if (FlushJobObject(jobObj) == JobFlushResult::Yielded)
+            {
+                Schedule(jobObj);
+            }
+            continue;
+        }
+
+        ParkWorker(index);
+    }
+
+    // 종료 전 남은 JobObject 처리 (다른 워커 큐도 함께 비움)
+    // 자기 자신에게 계속 PostJob하는 Job이 있으면 끝나지 않으므로 JobThread::DrainJobObjects와 같은 시간 상한
+    const JobFlushBudget budget = GetShutdownFlushBudget();
+    const auto drainStart = std::chrono::steady_clock::now();
+    while (TryPop(index, &jobObj))
+    {
+        if (FlushJobObject(jobObj, budget) == JobFlushResult::Yielded)
+        {
+            Schedule(jobObj);
+        }
+
+        if (std::chrono::steady_clock::now() - drainStart >= SHUTDOWN_DRAIN_TIMEOUT)
+        {
+            int remaining = 0;
+            for (const auto& worker : m_workers)
+            {
+                remaining += worker->queue.GetUseCount();
+            }
+            if (remaining > 0)
+            {
+                LOG_WARN("JobThreadPool: worker %d shutdown drain gave up, %d JobObjects left undrained", index, remaining);
+            }
+            break;
+        }
+    }
+
+    t_pool = nullptr;
+    t_workerIndex = -1;
+}
+
+bool JobThreadPool::TryPop(int index, JobObject** jobObj)
+{
+    if (m_workers[index]->queue.Dequeue(jobObj))
+    {
+        return true;
+    }
+
+    const int count = static_cast<int>(m_workers.size());
+    for (int i = 1; i < count; ++i)
+    {
+        if (m_workers[(index + i) % count]->queue.Dequeue(jobObj))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobThreadPool::WakeTimerThread()
+{
+    Worker& worker = *m_workers[0];
+    if (worker.parked.load() && worker.parked.exchange(false))
+    {
+        SetEvent(worker.wakeEvent);
+    }
+}
+
+bool JobThreadPool::HasPendingJobs(int index) const
+{
+    if (index == 0 && m_timerInbox.HasPending())
+    {
+        return true;
+    }
+
+    for (const auto& worker : m_workers)
+    {
+        if (worker->queue.GetUseCount() > 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobThreadPool::ParkWorker(int index)
+{
+    Worker& worker = *m_workers[index];
+
+    // 1. 스핀
+    const auto spinEnd = std::chrono::steady_clock::now() + IDLE_SPIN_DURATION;
+    do
+    {
+        if (HasPendingJobs(index) || !m_running.load())
+        {
+            return;
+        }
+        YieldProcessor();
+    } while (std::chrono::steady_clock::now() < spinEnd);
+
+    // 2. Park
+    // parked / m_parkedCount 공개 후 모든 큐 재확인 (Schedule의 Enqueue -> 확인 순서와 짝)
+    worker.parked.store(true);
+    m_parkedCount.fetch_add(1);
+    if (!HasPendingJobs(index) && m_running.load())
+    {
+        WaitForSingleObject(worker.wakeEvent, index == 0 ? GetParkTimeoutMs() : PARK_TIMEOUT_MS);
+    }
+    m_parkedCount.fetch_sub(1);
+    worker.parked.store(false);
+}
@@ -0,0 +1,79 @@
+﻿#pragma once
+#include "JobThreadBase.h"
+#include <thread>
+#include "../../JunCommon/container/LFQueue.h"
+#include <vector>
+#include <memory>
+
+//------------------------------
+// JobThreadPool - 워크 스틸링 JobThreadBase 구현 (단일 스레드판은 JobThread)
+// Scene에 묶이지 않는 시스템 매니저(GameObjectManager 등)용 코어 스레드를 여러 워커로 확장
+//
+// - 워커마다 자기 JobObject 큐를 가짐
+//   워커 안에서의 재스케줄은 자기 큐로, 외부 스레드(IOCP 등)의 PostJob은 라운드로빈 분배
+// - 자기 큐가 비면 다른 워커 큐에서 훔쳐옴 (한 워커가 긴 Job에 묶여도 나머지가 처리)
+// - JobObject 단위 직렬 실행은 그대로 보장 (m_processing CAS로 한 번에 한 큐에만 존재)
+//   단, 같은 JobObject라도 Flush마다 다른 워커에서 실행될 수 있으므로 thread_local 상태에 의존 금지
+// - JobThreadBase를 상속하므로 JobObject / GameObjectManager::Initialize에 JobThread 대신 전달 가능
+// - 타이머 휠은 하나 (0번 워커가 돌림), 만료된 Job은 owner 큐를 통해 아무 워커에서 실행
+//------------------------------
+class JobThreadPool : public JobThreadBase
+{
+private:
+    struct Worker
+    {
+        LFQueue<JobObject*> queue;    // 다른 워커가 훔쳐가므로 소비자가 여럿 (MPSCQueue 불가)
+        HANDLE wakeEvent = NULL;
+        std::atomic<bool> parked{false};
+        std::thread thread;
+    };
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::atomic<uint32_t> m_nextWorker{0};   // 외부 스레드 Schedule 분배용
+    std::atomic<int> m_parkedCount{0};
+
+    // 현재 스레드가 속한 풀 / 워커 번호 (워커 스레드가 아니면 nullptr / -1)
+    static thread_local JobThreadPool* t_pool;
+    static thread_local int t_workerIndex;
+
+public:
+    explicit JobThreadPool(int workerCount);
+    ~JobThreadPool() override;
+
+    //------------------------------
+    // JobObject 스케줄 (override)
+    // 대상 워커가 Park 중이면 깨우고, 바쁘면 Park 중인 다른 워커를 깨워 훔쳐가게 함
+    //------------------------------
+    void Schedule(JobObject* jobObject) override;
+
+    //------------------------------
+    // 워커 시작/종료 (override)
+    // 워커 i는 SetPlacement 정책의 (index + i)번째 슬롯에 배치
+    //------------------------------
+    void Start() override;
+    void Stop() override;
+
+    int GetWorkerCount() const { return static_cast<int>(m_workers.size()); }
+
+protected:
+    //------------------------------
+    // 타이머 휠 담당(0번 워커) 깨우기 (override)
+    //------------------------------
+    void WakeTimerThread() override;
+
+private:
+    void WorkerRun(int index);
+
+    //------------------------------
+    // 자기 큐 -> 다른 워커 큐 순서로 JobObject 하나 꺼냄
+    //------------------------------
+    bool TryPop(int index, JobObject** jobObj);
+
+    //------------------------------
+    // 유휴 대기 (JobThread::WaitForJobs와 같은 스핀 후 Park, 모든 워커 큐 확인)
+    //------------------------------
+    void ParkWorker(int index);
+
+    bool HasPendingJobs(int index) const;
+    void WakeIdleWorker(int skipIndex);
+};
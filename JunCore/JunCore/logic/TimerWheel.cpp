@@ -0,0 +1,98 @@
+﻿#include "TimerWheel.h"
+#include "../../JunCommon/pool/LFObjectPool.h"
+
+namespace
+{
+    // 종료 시점까지 살아있는 JobThread가 남은 노드를 반납하므로 풀은 해제하지 않음
+    LFObjectPool<TimerNode>& GetTimerNodePool()
+    {
+        static auto* pool = new LFObjectPool<TimerNode>();
+        return *pool;
+    }
+}
+
+TimerWheel::TimerWheel()
+    : m_currentTick(ToTick(Clock::now()))
+{
+}
+
+uint64_t TimerWheel::ToTick(Clock::time_point time)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count() / TICK.count());
+}
+
+void TimerWheel::Add(TimerNode* node)
+{
+    // 만료 시각이 속한 틱이 끝난 뒤에 발사 (일찍 발사하지 않음)
+    uint64_t tick = ToTick(node->expireAt) + 1;
+    if (tick <= m_currentTick)
+    {
+        tick = m_currentTick + 1;
+    }
+
+    node->expireTick = tick;
+    TimerNode*& head = m_slots[tick % SLOT_COUNT];
+    node->wheelNext = head;
+    head = node;
+
+    // 비어 있었으면 이 노드가 가장 이름, 캐시가 무효면 다음 조회 때 재계산
+    if (m_count == 0)
+    {
+        m_nextExpireTick = tick;
+        m_nextExpireValid = true;
+    }
+    else if (m_nextExpireValid && tick < m_nextExpireTick)
+    {
+        m_nextExpireTick = tick;
+    }
+    m_count++;
+}
+
+TimerWheel::Clock::duration TimerWheel::GetTimeToNextExpire(Clock::time_point now) const
+{
+    if (!m_nextExpireValid)
+    {
+        m_nextExpireTick = FindNextExpireTick();
+        m_nextExpireValid = true;
+    }
+
+    // expireTick은 ToTick(now)가 그 틱에 도달한 Advance에서 발사되므로 그 틱의 시작 시각까지 대기
+    const auto expireAt = Clock::time_point(std::chrono::duration_cast<Clock::duration>(TICK * static_cast<int64_t>(m_nextExpireTick)));
+    return expireAt - now;
+}
+
+uint64_t TimerWheel::FindNextExpireTick() const
+{
+    // 남은 노드는 모두 expireTick > m_currentTick
+    // 현재 틱 다음 슬롯부터 차례로 보며, 이번 바퀴에 만료되는 노드를 처음 만나면 그보다 이른 노드는 없음
+    uint64_t earliest = UINT64_MAX;
+    for (uint64_t i = 1; i <= SLOT_COUNT; i++)
+    {
+        const uint64_t tick = m_currentTick + i;
+        for (const TimerNode* node = m_slots[tick % SLOT_COUNT]; node != nullptr; node = node->wheelNext)
+        {
+            if (node->expireTick == tick)
+            {
+                return tick;
+            }
+            earliest = (std::min)(earliest, node->expireTick);
+        }
+    }
+    return earliest;
+}
+
+TimerNode* TimerWheel::AllocNode()
+{
+    return GetTimerNodePool().Alloc();
+}
+
+void TimerWheel::FreeNode(TimerNode* node)
+{
+    // 노드를 재사용하므로 빈 상태로 반납
+    node->job.Reset();
+    node->owner = nullptr;
+    node->interval = std::chrono::milliseconds{0};
+    node->id = 0;
+    node->wheelNext = nullptr;
+    GetTimerNodePool().Free(node);
+}
@@ -0,0 +1,151 @@
+﻿#pragma once
+#include "../../JunCommon/container/MPSCQueue.h"
+#include "Job.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+class JobObject;
+
+//------------------------------
+// TimerNode - JobObject 지연/반복 Job 하나
+// 스레드 간 이동: PostJobAfter(아무 스레드) -> JobThread 타이머 수신함(MPSC) -> TimerWheel -> 만료 시 owner의 Job으로
+//------------------------------
+struct TimerNode : MPSCQueueNode
+{
+    using Clock = std::chrono::steady_clock;
+
+    Job job;
+    JobObject* owner = nullptr;             // 노드가 살아있는 동안 owner 참조 1개 보유
+    Clock::time_point expireAt;
+    std::chrono::milliseconds interval{0};  // 0이면 1회성
+    uint64_t id = 0;                        // 반복 타이머 취소용 (owner 내 고유)
+
+    // TimerWheel 슬롯 링크 (휠 소유 스레드 전용)
+    TimerNode* wheelNext = nullptr;
+    uint64_t expireTick = 0;
+};
+
+//------------------------------
+// TimerWheel - 단일 레벨 해시 타이밍 휠 (JobThread / GameThread마다 하나, 소유 스레드 전용)
+//
+// - TICK 단위 SLOT_COUNT 슬롯, 한 바퀴(5.12초)보다 긴 지연은 같은 슬롯에서 바퀴 수만큼 대기
+// - Add O(1), Advance는 지나간 슬롯만 훑음 (타이머가 없으면 시계만 맞추고 끝)
+// - 가장 이른 만료 틱을 캐시 -> 소유 스레드는 다음 틱이 아니라 첫 만료까지 Park
+// - 만료 정밀도는 TICK 또는 소유 스레드 루프 주기(GameThread는 프레임) 중 큰 쪽
+//------------------------------
+class TimerWheel
+{
+public:
+    using Clock = TimerNode::Clock;
+
+    static constexpr std::chrono::milliseconds TICK{10};
+    static constexpr size_t SLOT_COUNT = 512;
+
+public:
+    TimerWheel();
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    //------------------------------
+    // 등록 (node->expireAt 기준, 이미 지났으면 다음 틱)
+    //------------------------------
+    void Add(TimerNode* node);
+
+    //------------------------------
+    // now까지 만료된 노드를 휠에서 떼어 onExpire(node)로 넘김
+    //------------------------------
+    template<typename F>
+    void Advance(Clock::time_point now, F&& onExpire);
+
+    //------------------------------
+    // 남은 노드 전부 떼어 넘김 (스레드 종료 시)
+    //------------------------------
+    template<typename F>
+    void Clear(F&& onRelease);
+
+    size_t GetCount() const { return m_count; }
+    bool IsEmpty() const { return m_count == 0; }
+
+    // 가장 이른 만료까지 남은 시간 (Park 대기 시간 계산용, 비어 있으면 호출하지 말 것)
+    Clock::duration GetTimeToNextExpire(Clock::time_point now) const;
+
+    //------------------------------
+    // TimerNode 풀 (생산자 / 해제 스레드가 다르므로 LFObjectPool)
+    //------------------------------
+    static TimerNode* AllocNode();
+    static void FreeNode(TimerNode* node);
+
+private:
+    static uint64_t ToTick(Clock::time_point time);
+
+    // 가장 이른 expireTick 재계산 (Advance로 만료가 빠진 뒤 처음 조회할 때)
+    uint64_t FindNextExpireTick() const;
+
+    std::array<TimerNode*, SLOT_COUNT> m_slots{};
+    uint64_t m_currentTick;
+    size_t m_count = 0;
+
+    // 가장 이른 expireTick 캐시 (Add는 즉시 갱신, Advance가 노드를 떼면 무효화)
+    mutable uint64_t m_nextExpireTick = 0;
+    mutable bool m_nextExpireValid = false;
+};
+
+template<typename F>
+void TimerWheel::Advance(Clock::time_point now, F&& onExpire)
+{
+    const uint64_t nowTick = ToTick(now);
+    if (nowTick <= m_currentTick)
+    {
+        return;
+    }
+
+    // 타이머가 없으면 슬롯을 훑지 않음
+    if (m_count == 0)
+    {
+        m_currentTick = nowTick;
+        return;
+    }
+
+    // 오래 멈춰 있었다면 한 바퀴만 훑으면 모든 슬롯을 확인한 것
+    const uint64_t steps = (std::min)(nowTick - m_currentTick, static_cast<uint64_t>(SLOT_COUNT));
+    for (uint64_t i = 1; i <= steps; i++)
+    {
+        TimerNode** link = &m_slots[(m_currentTick + i) % SLOT_COUNT];
+        while (TimerNode* node = *link)
+        {
+            if (node->expireTick <= nowTick)
+            {
+                *link = node->wheelNext;
+                node->wheelNext = nullptr;
+                m_count--;
+                m_nextExpireValid = false;
+                onExpire(node);
+            }
+            else
+            {
+                // 다음 바퀴 이후
+                link = &node->wheelNext;
+            }
+        }
+    }
+
+    m_currentTick = nowTick;
+}
+
+template<typename F>
+void TimerWheel::Clear(F&& onRelease)
+{
+    for (TimerNode*& head : m_slots)
+    {
+        while (TimerNode* node = head)
+        {
+            head = node->wheelNext;
+            node->wheelNext = nullptr;
+            onRelease(node);
+        }
+    }
+    m_count = 0;
+    m_nextExpireValid = false;
+}
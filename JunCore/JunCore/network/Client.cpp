@@ -1,5 +1,6 @@
 ﻿#include "Client.h"
 #include "../log.h"
+#include <algorithm>
 
 Client::Client(std::shared_ptr<IOCPManager> manager,
                const char* serverIP,
@@ -35,18 +36,35 @@ void Client::StartClient()
         return;
     }
 
+    {
+        std::lock_guard<std::mutex> lock(scheduleLock_);
+        slotAttempts_.assign(targetConnectionCount_, 0);
+        connectedSlots_.clear();
+        scheduledConnects_ = decltype(scheduledConnects_)();
+        inFlightConnects_  = 0;
+        rampTokens_        = 1.0;
+        lastRefillTime_    = Clock::now();
+    }
+
     // 재연결 스레드 시작
     reconnectThread_ = std::thread(&Client::ReconnectThreadFunc, this);
 
     // 사용자 정의 초기화 작업 수행
     OnClientStart();
 
-    // 초기 연결 시도
-    LOG_INFO("Starting %d initial connections to %s:%d", targetConnectionCount_, serverIP.c_str(), serverPort);
-    for (int i = 0; i < targetConnectionCount_; i++)
+    // 초기 연결 예약 (실제 시도는 ramp rate / in-flight 제한에 따라 재연결 스레드가 분산 수행)
+    LOG_INFO("Starting %d initial connections to %s:%d (ramp: %d/s, in-flight: %d)",
+             targetConnectionCount_, serverIP.c_str(), serverPort,
+             rampConfig_.connectsPerSecond, rampConfig_.maxInFlightConnects);
     {
-        PostConnectEx();
+        std::lock_guard<std::mutex> lock(scheduleLock_);
+        const auto now = Clock::now();
+        for (int i = 0; i < targetConnectionCount_; i++)
+        {
+            scheduledConnects_.push({ now, i });
+        }
     }
+    scheduleCv_.notify_one();
 }
 
 void Client::StopClient()
@@ -61,8 +79,15 @@ void Client::StopClient()
     // 사용자 정의 정리 작업 수행
     OnClientStop();
 
-    running_.store(false, std::memory_order_release);
-    reconnectSignal_.release();  // 스레드 깨우기
+    // OnClientStop에서 멈추지 않았으면 여기서 정리 (콜백이 파생 클래스 상태를 참조하므로 소멸 전에 멈춰야 함)
+    timerDriver_.Stop();
+
+    {
+        std::lock_guard<std::mutex> lock(scheduleLock_);
+        running_.store(false, std::memory_order_release);
+        scheduledConnects_ = decltype(scheduledConnects_)();
+    }
+    scheduleCv_.notify_all();  // 스레드 깨우기
 
     if (reconnectThread_.joinable())
     {
@@ -72,67 +97,168 @@ void Client::StopClient()
     LOG_INFO("Client stopped");
 }
 
+void Client::SetConnectRamp(const ConnectRampConfig& config)
+{
+    if (running_.load(std::memory_order_acquire))
+    {
+        LOG_WARN("SetConnectRamp() must be called before StartClient()");
+        return;
+    }
+
+    rampConfig_ = config;
+    rampConfig_.backoffBaseMs = (std::max)(1, rampConfig_.backoffBaseMs);
+    rampConfig_.backoffMaxMs  = (std::max)(rampConfig_.backoffBaseMs, rampConfig_.backoffMaxMs);
+    rampConfig_.jitterRatio   = std::clamp(rampConfig_.jitterRatio, 0.0, 1.0);
+}
+
+int Client::GetInFlightConnectCount() const
+{
+    std::lock_guard<std::mutex> lock(scheduleLock_);
+    return inFlightConnects_;
+}
+
+int Client::GetScheduledConnectCount() const
+{
+    std::lock_guard<std::mutex> lock(scheduleLock_);
+    return static_cast<int>(scheduledConnects_.size());
+}
+
 void Client::ReconnectThreadFunc()
 {
     LOG_DEBUG("Reconnect thread started");
 
-    constexpr int RECONNECT_DELAY_MS = 1000;
-    lastWakeupTime_ = std::chrono::steady_clock::now();
+    const int rate        = rampConfig_.connectsPerSecond;
+    const int maxInFlight = rampConfig_.maxInFlightConnects;
+    const double burst    = (std::max)(1.0, rate / 10.0);  // 최대 100ms 분량까지만 몰아서 시도
+
+    std::vector<int> readySlots;
+    std::unique_lock<std::mutex> lock(scheduleLock_);
 
     while (running_.load(std::memory_order_acquire))
     {
-        reconnectSignal_.acquire();
+        const auto now = Clock::now();
 
-        if (!running_.load(std::memory_order_acquire))
+        // ramp rate 토큰 보충
+        if (0 < rate)
         {
-            break;
+            const double elapsedSec = std::chrono::duration<double>(now - lastRefillTime_).count();
+            rampTokens_ = (std::min)(burst, rampTokens_ + elapsedSec * rate);
         }
+        lastRefillTime_ = now;
 
-        auto now        = std::chrono::steady_clock::now();
-        auto elapsed    = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastWakeupTime_).count();
-        lastWakeupTime_ = now;
-
-		// 얼마전에 깨워졌다면 추가 대기 (서버 내려간 경우 '연결 - 실패 - 재시도 - 연결 - 실패 - 재시도...' 루프를 지연시키기 위함)
-        if (elapsed < RECONNECT_DELAY_MS)
+        // 기한이 된 연결 중 in-flight / ramp 제한 내에서 꺼낸다
+        while (!scheduledConnects_.empty() && scheduledConnects_.top().dueTime <= now)
         {
-            auto remainingDelay = RECONNECT_DELAY_MS - elapsed;
-            LOG_DEBUG("Additional sleep for %lld ms (elapsed: %lld ms)", remainingDelay, elapsed);
-            std::this_thread::sleep_for(std::chrono::milliseconds(remainingDelay));
+            if (0 < maxInFlight && maxInFlight <= inFlightConnects_) break;
+            if (0 < rate && rampTokens_ < 1.0) break;
+
+            readySlots.push_back(scheduledConnects_.top().slot);
+            scheduledConnects_.pop();
+            ++inFlightConnects_;
+            if (0 < rate) rampTokens_ -= 1.0;
         }
 
-        // 재연결 시도
-        int pending = pendingConnectCount_.load(std::memory_order_acquire);
-        if (pending > 0)
+        if (!readySlots.empty())
         {
-            LOG_INFO("Reconnecting %d failed connections", pending);
+            // ConnectEx 호출은 락 밖에서 (실패 시 OnConnectResult가 다시 락을 잡음)
+            lock.unlock();
 
-            for (int i = 0; i < pending; i++)
+            LOG_DEBUG("Posting %zu scheduled connects", readySlots.size());
+            for (int slot : readySlots)
             {
-                PostConnectEx();
+                if (!PostConnectEx(slot))
+                {
+                    OnConnectResult(slot, nullptr, false);
+                }
             }
+            readySlots.clear();
+
+            lock.lock();
+            continue;
+        }
 
-            pendingConnectCount_.fetch_sub(pending, std::memory_order_release);
+        // 다음 깨어날 시점 계산
+        if (scheduledConnects_.empty() || (0 < maxInFlight && maxInFlight <= inFlightConnects_))
+        {
+            // 새 예약 or connect 완료 통지까지 대기
+            scheduleCv_.wait(lock);
+        }
+        else
+        {
+            auto wakeTime = scheduledConnects_.top().dueTime;
+            if (0 < rate && rampTokens_ < 1.0)
+            {
+                const auto tokenWait = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>((1.0 - rampTokens_) / rate));
+                wakeTime = (std::max)(wakeTime, now + tokenWait);
+            }
+            scheduleCv_.wait_until(lock, wakeTime);
         }
     }
 
     LOG_DEBUG("Reconnect thread stopped");
 }
 
-void Client::TriggerReconnect()
+void Client::ScheduleConnectLocked(int slot, bool applyBackoff)
+{
+    auto dueTime = Clock::now();
+
+    if (applyBackoff)
+    {
+        // 지수 백오프: base * 2^attempt (최대 backoffMaxMs)
+        const int attempt = (std::min)(slotAttempts_[slot]++, 20);
+        const long long backoffMs = (std::min<long long>)(static_cast<long long>(rampConfig_.backoffBaseMs) << attempt, rampConfig_.backoffMaxMs);
+
+        // jitter: 같은 시점에 끊긴 연결들이 같은 시점에 재시도하지 않도록 분산
+        std::uniform_real_distribution<double> jitterDist(0.0, rampConfig_.jitterRatio);
+        const auto delayMs = static_cast<long long>(backoffMs * (1.0 - jitterDist(jitterGen_)));
+
+        dueTime += std::chrono::milliseconds(delayMs);
+        LOG_DEBUG("Connect slot %d scheduled in %lld ms (attempt %d)", slot, delayMs, attempt + 1);
+    }
+
+    scheduledConnects_.push({ dueTime, slot });
+}
+
+void Client::OnConnectResult(int slot, User* user, bool success)
 {
-    pendingConnectCount_.fetch_add(1, std::memory_order_release);
-    reconnectSignal_.release();
+    {
+        std::lock_guard<std::mutex> lock(scheduleLock_);
+        --inFlightConnects_;
+
+        if (success)
+        {
+            slotAttempts_[slot] = 0;
+            connectedSlots_[user] = slot;
+        }
+        else if (running_.load(std::memory_order_acquire))
+        {
+            ScheduleConnectLocked(slot, true);
+        }
+    }
+
+    scheduleCv_.notify_one();
 }
 
 void Client::OnUserDisconnect(User* user)
 {
     LOG_INFO("User disconnected, triggering reconnect");
 
-    // 재연결 트리거
-    if (running_.load(std::memory_order_acquire))
+    // 재연결 예약 (끊긴 슬롯을 백오프 후 재시도)
     {
-        TriggerReconnect();
+        std::lock_guard<std::mutex> lock(scheduleLock_);
+        auto it = connectedSlots_.find(user);
+        if (it != connectedSlots_.end())
+        {
+            const int slot = it->second;
+            connectedSlots_.erase(it);
+
+            if (running_.load(std::memory_order_acquire))
+            {
+                ScheduleConnectLocked(slot, true);
+            }
+        }
     }
+    scheduleCv_.notify_one();
 
     delete user;
 }
@@ -167,7 +293,7 @@ bool Client::LoadConnectExFunctions()
     return true;
 }
 
-bool Client::PostConnectEx()
+bool Client::PostConnectEx(int slot)
 {
     if (!fnConnectEx)
     {
@@ -207,6 +333,7 @@ bool Client::PostConnectEx()
     // Session 사전 생성 및 설정
     auto session = std::make_shared<Session>();
     session->sock_ = clientSocket;
+    session->connect_slot_ = slot;
     session->SetEngine(this);
 
     // OverlappedEx 생성
@@ -2,11 +2,17 @@
 #include "NetBase.h"
 #include "Session.h"
 #include "User.h"
+#include "ClientTimerDriver.h"
 #include <atomic>
 #include <string>
 #include <memory>
 #include <thread>
-#include <semaphore>
+#include <mutex>
+#include <condition_variable>
+#include <queue>
+#include <unordered_map>
+#include <random>
+#include <chrono>
 #include <mswsock.h>
 
 // ConnectEx 함수 포인터 타입 정의
@@ -20,9 +26,22 @@ typedef BOOL(WINAPI* LPFN_CONNECTEX)(
     LPOVERLAPPED lpOverlapped
 );
 
+//------------------------------
+// ConnectRampConfig - 연결 스케줄러 설정
+// 서버 재시작 시 다수 연결이 동시에 몰리지 않도록 connect 시도를 분산
+//------------------------------
+struct ConnectRampConfig
+{
+    int connectsPerSecond   = 100;      // 초당 최대 connect 시도 수 (0 = 제한 없음)
+    int maxInFlightConnects = 64;       // 동시 진행 중인 ConnectEx 최대 수 (0 = 제한 없음)
+    int backoffBaseMs       = 1000;     // 재연결 기본 지연 (실패 시마다 2배)
+    int backoffMaxMs        = 30000;    // 재연결 최대 지연
+    double jitterRatio      = 0.5;      // 지연 중 무작위로 줄일 최대 비율 (0.0 ~ 1.0)
+};
+
 //------------------------------
 // Client - 클라이언트 네트워크 엔진
-// 자동 재연결 지원
+// 자동 재연결 지원 (연결 슬롯별 지수 백오프 + ramp rate 제한)
 //------------------------------
 class Client : public NetBase
 {
@@ -45,6 +64,13 @@ public:
     void StartClient();
     void StopClient();
 
+    // StartClient() 호출 전에 설정
+    void SetConnectRamp(const ConnectRampConfig& config);
+
+    // 연결 스케줄러 상태 조회
+    int GetInFlightConnectCount() const;
+    int GetScheduledConnectCount() const;
+
 protected:
     //------------------------------
     // 클라이언트 전용 가상함수 - 사용자가 재정의
@@ -55,6 +81,15 @@ protected:
     virtual void OnConnectComplete(User* user, bool success) = 0;
     void OnUserDisconnect(User* user) override;
 
+    //------------------------------
+    // 연결 슬롯별 주기 타이머 (부하 발생기의 송신/행동 주기용, 동작은 ClientTimerDriver 참고)
+    // OnClientStart에서 시작, 파생 클래스 상태를 정리하기 전에 StopTimerDriver
+    //------------------------------
+    bool StartTimerDriver(int threadCount, ClientTimerDriver::Callback callback) { return timerDriver_.Start(threadCount, std::move(callback)); }
+    void StopTimerDriver() { timerDriver_.Stop(); }
+    void ScheduleTimer(int slot, uint32_t generation, ClientTimerDriver::Clock::time_point dueTime) { timerDriver_.Schedule(slot, generation, dueTime); }
+    int GetTimerThreadCount() const { return timerDriver_.GetThreadCount(); }
+
 private:
     //------------------------------
     // 서버 연결 정보
@@ -64,18 +99,41 @@ private:
     int targetConnectionCount_;
 
     // 재연결 관리
-    std::atomic<int> pendingConnectCount_{0};
+    using Clock = std::chrono::steady_clock;
+
+    struct ScheduledConnect
+    {
+        Clock::time_point dueTime;
+        int slot;
+
+        bool operator>(const ScheduledConnect& other) const { return dueTime > other.dueTime; }
+    };
+
     std::atomic<bool> running_{false};
     std::thread reconnectThread_;
-    std::binary_semaphore reconnectSignal_{0};  // 이벤트 역할 (0=non-signaled, 1=signaled)
-    std::chrono::steady_clock::time_point lastWakeupTime_;  // 마지막 재연결 스레드 깨어난 시간
+    ConnectRampConfig rampConfig_;
+
+    // 아래 멤버는 scheduleLock_으로 보호
+    mutable std::mutex scheduleLock_;
+    std::condition_variable scheduleCv_;
+    std::priority_queue<ScheduledConnect, std::vector<ScheduledConnect>, std::greater<ScheduledConnect>> scheduledConnects_;
+    std::vector<int> slotAttempts_;                     // 슬롯별 연속 실패 횟수 (백오프 지수)
+    std::unordered_map<User*, int> connectedSlots_;     // 연결된 User -> 슬롯
+    int inFlightConnects_ = 0;                          // ConnectEx 완료 대기 중인 수
+    double rampTokens_ = 0.0;                           // ramp rate 토큰 버킷
+    Clock::time_point lastRefillTime_;
+    std::mt19937 jitterGen_{ std::random_device{}() };
 
     // ConnectEx 함수 포인터
     LPFN_CONNECTEX fnConnectEx = nullptr;
 
+    // 연결 슬롯별 주기 타이머
+    ClientTimerDriver timerDriver_;
+
     // 내부 헬퍼 함수들
     void ReconnectThreadFunc();
-    void TriggerReconnect();
+    void ScheduleConnectLocked(int slot, bool applyBackoff);
+    void OnConnectResult(int slot, User* user, bool success);  // IOCPManager에서 호출
     bool LoadConnectExFunctions();
-    bool PostConnectEx();
+    bool PostConnectEx(int slot);
 };
\ No newline at end of file
@@ -0,0 +1,104 @@
+﻿#include "ClientTimerDriver.h"
+#include <algorithm>
+
+ClientTimerDriver::~ClientTimerDriver()
+{
+    Stop();
+}
+
+bool ClientTimerDriver::Start(int threadCount, Callback callback)
+{
+    if (!workers_.empty())
+    {
+        return false;
+    }
+
+    callback_ = std::move(callback);
+
+    const int workerCount = (std::max)(1, threadCount);
+    for (int i = 0; i < workerCount; i++)
+    {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+
+    // Schedule이 workers_를 보기 전에 모두 생성되어 있어야 함
+    running_.store(true, std::memory_order_release);
+    for (int i = 0; i < workerCount; i++)
+    {
+        workers_[i]->thread = std::thread(&ClientTimerDriver::WorkerThreadFunc, this, i);
+    }
+    return true;
+}
+
+void ClientTimerDriver::Stop()
+{
+    if (!running_.exchange(false, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    for (auto& worker : workers_)
+    {
+        {
+            // 대기 진입 직전의 스레드가 notify를 놓치지 않도록 lock 안에서 깨움
+            std::lock_guard<std::mutex> lock(worker->lock);
+            worker->cv.notify_all();
+        }
+        if (worker->thread.joinable())
+        {
+            worker->thread.join();
+        }
+    }
+
+    // workers_는 소멸 시까지 유지 (Stop과 겹친 Schedule이 해제된 Worker를 보지 않도록)
+}
+
+void ClientTimerDriver::Schedule(int slot, uint32_t generation, Clock::time_point dueTime)
+{
+    if (!running_.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    Worker& worker = *workers_[slot % workers_.size()];
+    {
+        std::lock_guard<std::mutex> lock(worker.lock);
+        worker.timers.push({ dueTime, slot, generation });
+    }
+
+    // 가장 이른 타이머가 바뀌었을 수 있으므로 깨움
+    worker.cv.notify_one();
+}
+
+void ClientTimerDriver::WorkerThreadFunc(int workerIndex)
+{
+    Worker& worker = *workers_[workerIndex];
+
+    std::unique_lock<std::mutex> lock(worker.lock);
+    while (running_.load(std::memory_order_acquire))
+    {
+        if (worker.timers.empty())
+        {
+            worker.cv.wait(lock);
+            continue;
+        }
+
+        const Timer timer = worker.timers.top();
+        if (Clock::now() < timer.dueTime)
+        {
+            // 더 이른 타이머가 추가되면 notify로 깨어남
+            worker.cv.wait_until(lock, timer.dueTime);
+            continue;
+        }
+        worker.timers.pop();
+
+        lock.unlock();
+        const std::optional<Clock::time_point> nextDue = callback_(timer.slot, timer.generation, timer.dueTime);
+        lock.lock();
+
+        if (nextDue)
+        {
+            worker.timers.push({ *nextDue, timer.slot, timer.generation });
+        }
+    }
+}
@@ -0,0 +1,72 @@
+﻿#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <thread>
+#include <vector>
+
+//------------------------------
+// ClientTimerDriver - 연결 슬롯별 주기 타이머
+// 다수 연결(세션/봇)의 주기 작업을 연결별 스레드 대신 소수 스레드의 min-heap으로 처리
+// - 슬롯 s는 항상 s % threadCount 스레드가 처리 (같은 슬롯 콜백은 순차 실행)
+// - 콜백은 스레드 내부 lock 밖에서 호출 -> 슬롯 상태 보호는 사용자 몫, 콜백 안에서 Schedule 가능
+// - generation은 연결마다 바꿔 이전 연결의 타이머를 콜백에서 걸러내는 용도
+//------------------------------
+class ClientTimerDriver
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // 반환값이 있으면 그 시각에 같은 slot / generation으로 다시 호출
+    using Callback = std::function<std::optional<Clock::time_point>(int slot, uint32_t generation, Clock::time_point dueTime)>;
+
+public:
+    ClientTimerDriver() = default;
+    ~ClientTimerDriver();
+
+    ClientTimerDriver(const ClientTimerDriver&) = delete;
+    ClientTimerDriver& operator=(const ClientTimerDriver&) = delete;
+
+    // 한 번만 시작 가능 (Stop 후 재시작 불가)
+    bool Start(int threadCount, Callback callback);
+
+    // 스레드 종료 대기, 남은 타이머는 폐기 (콜백 실행 중이면 끝날 때까지 대기)
+    void Stop();
+
+    // 실행 중이 아니면 무시
+    void Schedule(int slot, uint32_t generation, Clock::time_point dueTime);
+
+    bool IsRunning() const { return running_.load(std::memory_order_acquire); }
+    int GetThreadCount() const { return static_cast<int>(workers_.size()); }
+
+private:
+    struct Timer
+    {
+        Clock::time_point dueTime;
+        int slot;
+        uint32_t generation;
+
+        bool operator>(const Timer& other) const { return dueTime > other.dueTime; }
+    };
+
+    struct Worker
+    {
+        std::mutex lock;
+        std::condition_variable cv;
+        std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>> timers;
+        std::thread thread;
+    };
+
+    void WorkerThreadFunc(int workerIndex);
+
+private:
+    Callback callback_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<bool> running_{false};
+};
@@ -3,29 +3,79 @@
 #include "Server.h"
 #include "Client.h"
 #include "../protocol/UnifiedPacketHeader.h"
+#include <chrono>
 
 //------------------------------
 // IOCPManager 구현 - 패킷 조립 로직
 //------------------------------
 
-void IOCPManager::RunWorkerThread()
+void IOCPManager::SpawnWorker()
 {
+    const int workerIndex = spawnedWorkers++;
+    activeWorkers.fetch_add(1);
+    workerThreads.emplace_back([this, workerIndex]() { RunWorkerThread(workerIndex); });
+}
+
+void IOCPManager::RunWorkerThread(int workerIndex)
+{
+    // 배치 정책은 TLS 카운터 생성 전에 적용 (첫 접근 메모리가 배치된 노드에 할당되도록)
+    if (!workerPlacement.ApplyToCurrentThread(workerIndex))
+    {
+        LOG_WARN("IOCP worker %d: failed to apply placement %s (error %d)", workerIndex, workerPlacement.ToString().c_str(), GetLastError());
+    }
+
     thread_local TimeWindowCounter<uint64_t> tlsRecvCounter;
     thread_local TimeWindowCounter<uint64_t> tlsSendCounter;
     
-    static std::atomic<int> nextWorkerIndex{0};
-    const int workerIndex = nextWorkerIndex.fetch_add(1);
-    
     recvCounters[workerIndex] = &tlsRecvCounter;
     sendCounters[workerIndex] = &tlsSendCounter;
+    WorkerStats& stats = workerStats[workerIndex];
+
+    // busy 시간 측정은 적응형 풀에서만 (컨트롤러 입력)
+    const bool measureBusy = IsAdaptiveWorkersEnabled();
+    std::chrono::steady_clock::time_point busyStart;
     
     for (;;) 
     {
         DWORD ioSize                = 0;
-        ULONG_PTR completionKey     = 0; // 사용하지 않음
+        ULONG_PTR completionKey     = 0; // park 요청 구분용
         OverlappedEx* p_overlapped  = nullptr;
 
-		BOOL retGQCS = GetQueuedCompletionStatus(iocpHandle, &ioSize, &completionKey, (LPOVERLAPPED*)&p_overlapped, INFINITE);
+        if (measureBusy && stats.busy.load(std::memory_order_relaxed))
+        {
+            const auto elapsed = std::chrono::steady_clock::now() - busyStart;
+            stats.busyNs.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(), std::memory_order_relaxed);
+            stats.busy.store(false, std::memory_order_relaxed);
+        }
+
+		BOOL retGQCS = WaitCompletion(stats, &ioSize, &completionKey, &p_overlapped);
+
+        if (measureBusy)
+        {
+            busyStart = std::chrono::steady_clock::now();
+            stats.busy.store(true, std::memory_order_relaxed);
+        }
+
+        // 컨트롤러의 park 요청 - 깨울 때까지 대기
+        if (p_overlapped == nullptr && completionKey == WORKER_PARK_KEY)
+        {
+            stats.busy.store(false, std::memory_order_relaxed);
+            if (shutdown.load())
+            {
+                break;
+            }
+
+            activeWorkers.fetch_sub(1);
+            parkedWorkers.fetch_add(1);
+            WaitForSingleObject(parkSemaphore, INFINITE);
+
+            // 깨운 쪽(ScaleUp)이 카운트를 조정함, Shutdown으로 깨어난 경우 종료
+            if (shutdown.load())
+            {
+                break;
+            }
+            continue;
+        }
 
         // IOCP 종료 메시지
         if (ioSize == 0 && p_overlapped == nullptr)
@@ -35,7 +85,7 @@ void IOCPManager::RunWorkerThread()
             break;
         }
 
-		if (ioSize == 0 && p_overlapped->operation_ != IOOperation::IO_ACCEPT && p_overlapped->operation_ != IOOperation::IO_CONNECT)
+		if (ioSize == 0 && p_overlapped->operation_ != IOOperation::IO_ACCEPT && p_overlapped->operation_ != IOOperation::IO_CONNECT && p_overlapped->operation_ != IOOperation::IO_RECV_RESUME)
         {
             goto DecrementIOCount;
         }
@@ -76,6 +126,15 @@ void IOCPManager::RunWorkerThread()
 			HandleConnectComplete(p_overlapped->session_.get(), ioSize);
 		} break;
 
+		case IOOperation::IO_RECV_RESUME:
+		{
+			// 수신 제한으로 보류된 패킷 처리 재개 (새로 수신된 바이트 없음)
+			if (!p_overlapped->session_->pending_disconnect_)
+			{
+				HandleRecvComplete(p_overlapped->session_.get(), 0);
+			}
+		} break;
+
         default:
         {
             LOG_ERROR("invalid io operation : %d", p_overlapped->operation_);
@@ -87,6 +146,173 @@ void IOCPManager::RunWorkerThread()
 	}
 }
 
+BOOL IOCPManager::WaitCompletion(WorkerStats& stats, DWORD* ioSize, ULONG_PTR* completionKey, OverlappedEx** overlapped)
+{
+    if (0 < busyPollSpinUs)
+    {
+        const auto spinEnd = std::chrono::steady_clock::now() + std::chrono::microseconds(busyPollSpinUs);
+        do
+        {
+            BOOL ret = GetQueuedCompletionStatus(iocpHandle, ioSize, completionKey, (LPOVERLAPPED*)overlapped, 0);
+
+            // 완료 패킷 획득 (성공 또는 실패한 I/O), 타임아웃만 아니면 반환
+            if (ret || *overlapped != nullptr || GetLastError() != WAIT_TIMEOUT)
+            {
+                stats.spinHits.fetch_add(1, std::memory_order_relaxed);
+                return ret;
+            }
+
+            YieldProcessor();
+        } while (std::chrono::steady_clock::now() < spinEnd);
+
+        stats.blockingWaits.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return GetQueuedCompletionStatus(iocpHandle, ioSize, completionKey, (LPOVERLAPPED*)overlapped, INFINITE);
+}
+
+uint64_t IOCPManager::GetSpinHitCount() const
+{
+    uint64_t total = 0;
+    for (size_t i = 0; i < recvCounters.size(); ++i)
+    {
+        total += workerStats[i].spinHits.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+uint64_t IOCPManager::GetBlockingWaitCount() const
+{
+    uint64_t total = 0;
+    for (size_t i = 0; i < recvCounters.size(); ++i)
+    {
+        total += workerStats[i].blockingWaits.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+IOCPManager::WorkerPoolStats IOCPManager::GetWorkerPoolStats() const
+{
+    WorkerPoolStats result;
+    result.activeWorkers  = activeWorkers.load();
+    result.parkedWorkers  = parkedWorkers.load();
+    result.threadCount    = result.activeWorkers + result.parkedWorkers;
+    result.minWorkers     = minWorkers;
+    result.maxWorkers     = maxWorkers;
+    result.scaleUpCount   = scaleUpCount.load(std::memory_order_relaxed);
+    result.scaleDownCount = scaleDownCount.load(std::memory_order_relaxed);
+    result.utilization    = lastUtilization.load(std::memory_order_relaxed);
+    result.saturation     = lastSaturation.load(std::memory_order_relaxed);
+    return result;
+}
+
+//------------------------------
+// 적응형 Worker 풀 컨트롤러
+//------------------------------
+void IOCPManager::RunWorkerController()
+{
+    // IOCP는 대기 중인 완료 수(큐 깊이)를 노출하지 않으므로
+    // "활성 Worker 전원이 busy인 샘플 비율"을 큐 적체 추정치로 사용
+    auto sumBusyNs = [this]()
+    {
+        uint64_t total = 0;
+        for (int i = 0; i < maxWorkers; ++i)
+        {
+            total += workerStats[i].busyNs.load(std::memory_order_relaxed);
+        }
+        return total;
+    };
+
+    uint64_t prevBusyNs = sumBusyNs();
+    auto windowStart = std::chrono::steady_clock::now();
+    int samples = 0;
+    int saturatedSamples = 0;
+
+    while (WaitForSingleObject(controllerStopEvent, SATURATION_SAMPLE_MS) == WAIT_TIMEOUT)
+    {
+        const int active = activeWorkers.load();
+
+        int busyCount = 0;
+        for (int i = 0; i < maxWorkers; ++i)
+        {
+            if (workerStats[i].busy.load(std::memory_order_relaxed))
+            {
+                ++busyCount;
+            }
+        }
+
+        ++samples;
+        if (0 < active && active <= busyCount)
+        {
+            ++saturatedSamples;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        const auto windowNs = std::chrono::duration_cast<std::chrono::nanoseconds>(now - windowStart).count();
+        if (windowNs < static_cast<long long>(adaptiveIntervalMs) * 1000000)
+        {
+            continue;
+        }
+
+        // 구간 평균 산출 (진행 중인 busy 구간은 다음 구간에 반영됨)
+        const uint64_t busyNs = sumBusyNs();
+        const double utilization = (0 < active) ? static_cast<double>(busyNs - prevBusyNs) / (static_cast<double>(windowNs) * active) : 0.0;
+        const double saturation = static_cast<double>(saturatedSamples) / samples;
+
+        lastUtilization.store((std::min)(utilization, 1.0), std::memory_order_relaxed);
+        lastSaturation.store(saturation, std::memory_order_relaxed);
+
+        // 구간당 최대 1개씩 조정 (진동 방지)
+        if ((SCALE_UP_UTILIZATION <= utilization || SCALE_UP_SATURATION <= saturation) && active < maxWorkers)
+        {
+            ScaleUp();
+            LOG_INFO("IOCP worker pool scaled up: active=%d, utilization=%.2f, saturation=%.2f", activeWorkers.load(), utilization, saturation);
+        }
+        else if (utilization <= SCALE_DOWN_UTILIZATION && saturation < SCALE_UP_SATURATION && minWorkers < active)
+        {
+            ScaleDown();
+            LOG_INFO("IOCP worker pool scaling down: active=%d, utilization=%.2f, saturation=%.2f", active - 1, utilization, saturation);
+        }
+
+        prevBusyNs = busyNs;
+        windowStart = now;
+        samples = 0;
+        saturatedSamples = 0;
+    }
+}
+
+void IOCPManager::ScaleUp()
+{
+    // park된 Worker 우선 재사용, 없으면 신규 생성
+    int parked = parkedWorkers.load();
+    if (0 < parked)
+    {
+        parkedWorkers.fetch_sub(1);
+        activeWorkers.fetch_add(1);
+        ReleaseSemaphore(parkSemaphore, 1, NULL);
+    }
+    else if (spawnedWorkers < maxWorkers)
+    {
+        SpawnWorker();
+    }
+    else
+    {
+        // park 요청이 아직 처리되지 않은 경우 - 다음 구간에 재판단
+        return;
+    }
+
+    scaleUpCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void IOCPManager::ScaleDown()
+{
+    // 대기 중인 완료 뒤에 큐잉되므로 밀린 작업을 처리한 Worker가 park됨
+    if (PostQueuedCompletionStatus(iocpHandle, 0, WORKER_PARK_KEY, nullptr))
+    {
+        scaleDownCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
 void IOCPManager::HandleRecvComplete(Session* session, DWORD ioSize)
 {
 	int loopCount = 0;
@@ -121,9 +347,47 @@ void IOCPManager::HandleRecvComplete(Session* session, DWORD ioSize)
             break;
         }
 
+        // 수신 제한 검사 (파싱 전, 헤더만 Peek)
+        {
+            UnifiedPacketHeader peekHeader;
+            session->recv_buf_.Peek(&peekHeader, UNIFIED_HEADER_SIZE);
+
+            NetBase* engine = session->GetEngine();
+            IngressAction action;
+            DWORD waitMs;
+            if (engine && !CheckIngressLimit(engine, session, peekHeader.packet_id, action, waitMs))
+            {
+                switch (action)
+                {
+                case IngressAction::DROP:
+                {
+                    session->recv_buf_.MoveFront(_packet_len);
+                    engine->ingress_dropped_count_.fetch_add(1, std::memory_order_relaxed);
+                    LOG_DEBUG("Ingress limit: dropped packet id=%u", peekHeader.packet_id);
+                } continue;
+
+                case IngressAction::DISCONNECT:
+                {
+                    engine->ingress_disconnect_count_.fetch_add(1, std::memory_order_relaxed);
+                    LOG_WARN("Ingress limit exceeded: packet id=%u, disconnecting session", peekHeader.packet_id);
+                    session->Disconnect();
+                } return;
+
+                case IngressAction::DEFER:
+                default:
+                {
+                    // 남은 데이터는 수신 버퍼에 보관, Recv도 재등록하지 않음 (토큰 충전 후 재개)
+                    engine->ingress_deferred_count_.fetch_add(1, std::memory_order_relaxed);
+                    ScheduleRecvResume(session, waitMs);
+                } return;
+                }
+            }
+        }
+
         // 패킷 추출
 		std::vector<char> packet(_packet_len);
         session->recv_buf_.Dequeue(&packet[0], _packet_len);
+        session->CaptureInbound(packet.data(), _packet_len);
 
         const UnifiedPacketHeader* header = reinterpret_cast<const UnifiedPacketHeader*>(&packet[0]);
 
@@ -180,7 +444,7 @@ void IOCPManager::HandleSendComplete(Session* session)
         return;
     }
 
-    if (session->send_q_.GetUseCount() > 0)
+    if (session->GetSendQueueCount() > 0)
     {
         session->SendAsync();
     }
@@ -194,14 +458,11 @@ double IOCPManager::GetRecvBytesPerSecond(int seconds) const
     double total = 0.0;
     for (auto* counter : recvCounters) 
     {
+        // 적응형 풀에서 아직 생성되지 않은 Worker 슬롯은 nullptr
         if (counter != nullptr) 
         {
             total += counter->get_average(seconds);
         }
-        else
-        {
-			LOG_ERROR("recvCounters contains a null pointer");
-        }
     }
     return total;
 }
@@ -211,14 +472,11 @@ double IOCPManager::GetSendBytesPerSecond(int seconds) const
     double total = 0.0;
     for (auto* counter : sendCounters) 
     {
+        // 적응형 풀에서 아직 생성되지 않은 Worker 슬롯은 nullptr
         if (counter != nullptr) 
         {
             total += counter->get_average(seconds);
         }
-		else
-		{
-			LOG_ERROR("sendCounters contains a null pointer");
-		}
     }
     return total;
 }
@@ -244,6 +502,13 @@ void IOCPManager::HandleAcceptComplete(Session* session, DWORD ioSize)
         closesocket(acceptSocket);
         goto PostNewAccept;
     }
+
+    // drain/정지 중이면 신규 연결 거부 (AcceptEx 재등록 안함)
+    if (!server->IsAccepting())
+    {
+        closesocket(acceptSocket);
+        return;
+    }
     
     // AcceptEx 완료 후 필수 setsockopt 호출
     listenSocket = server->listenSocket;
@@ -267,6 +532,7 @@ void IOCPManager::HandleAcceptComplete(Session* session, DWORD ioSize)
     // Session 완전 설정
     user = new User(session->shared_from_this());
     session->Set(acceptSocket, clientAddr.sin_addr, ntohs(clientAddr.sin_port), server, iocpHandle, user);
+    server->RegisterSession(session->shared_from_this());
     server->OnSessionConnect(user);
     session->RecvAsync();
 
@@ -277,6 +543,49 @@ PostNewAccept:
     }
 }
 
+bool IOCPManager::CheckIngressLimit(NetBase* engine, Session* session, uint32_t packet_id, IngressAction& outAction, DWORD& outWaitMs)
+{
+    const IngressLimit& sessionLimit = engine->session_ingress_limit_;
+    const IngressLimit* typeLimit = engine->FindIngressLimit(packet_id);
+
+    // 제한 미설정 시 빠른 경로
+    if (!sessionLimit.IsEnabled() && (!typeLimit || !typeLimit->IsEnabled()))
+    {
+        return true;
+    }
+
+    return session->ingress_limiter_.TryAcquire(sessionLimit, typeLimit, packet_id, GetTickCount64(), outAction, outWaitMs);
+}
+
+void IOCPManager::ScheduleRecvResume(Session* session, DWORD delayMs)
+{
+    // 세션 참조는 OverlappedEx가 유지, 타이머 만료 시 Worker로 재개 통지
+    auto resumeOverlapped = new OverlappedEx(session->shared_from_this(), IOOperation::IO_RECV_RESUME);
+
+    PTP_TIMER timer = CreateThreadpoolTimer([](PTP_CALLBACK_INSTANCE, PVOID context, PTP_TIMER timer)
+    {
+        auto overlapped = static_cast<OverlappedEx*>(context);
+        PostQueuedCompletionStatus(overlapped->session_->GetIOCP(), 0, 0, &overlapped->overlapped_);
+        CloseThreadpoolTimer(timer);
+    }, resumeOverlapped, nullptr);
+
+    if (timer == nullptr)
+    {
+        LOG_ERROR("CreateThreadpoolTimer failed: %d, resuming immediately", GetLastError());
+        PostQueuedCompletionStatus(iocpHandle, 0, 0, &resumeOverlapped->overlapped_);
+        return;
+    }
+
+    // 상대 시간 (100ns 단위, 음수)
+    ULARGE_INTEGER dueTime;
+    dueTime.QuadPart = static_cast<ULONGLONG>(-static_cast<LONGLONG>(delayMs) * 10000);
+
+    FILETIME fileDueTime;
+    fileDueTime.dwLowDateTime  = dueTime.LowPart;
+    fileDueTime.dwHighDateTime = dueTime.HighPart;
+    SetThreadpoolTimer(timer, &fileDueTime, 0, 0);
+}
+
 void IOCPManager::HandleConnectComplete(Session* session, DWORD ioSize)
 {
     SOCKET connectSocket;
@@ -320,6 +629,9 @@ void IOCPManager::HandleConnectComplete(Session* session, DWORD ioSize)
         }
 
         session->Set(connectSocket, localAddr.sin_addr, ntohs(localAddr.sin_port), client, iocpHandle, user);
+
+        // Recv 등록 전에 슬롯 등록 (끊김 통지가 먼저 도착하지 않도록)
+        client->OnConnectResult(session->connect_slot_, user, true);
         session->RecvAsync();
 
         LOG_INFO("Connection established successfully");
@@ -330,7 +642,7 @@ void IOCPManager::HandleConnectComplete(Session* session, DWORD ioSize)
         // 연결 실패 - 재연결 트리거
         LOG_WARN("Connection failed, triggering reconnect");
         closesocket(connectSocket);
-        client->TriggerReconnect();
+        client->OnConnectResult(session->connect_slot_, nullptr, false);
         client->OnConnectComplete(nullptr, false);
     }
 }
\ No newline at end of file
@@ -1,13 +1,16 @@
 ﻿#pragma once
 #include "../core/WindowsIncludes.h"
 #include "Session.h"
+#include "IngressLimit.h"
 #include "../../JunCommon/timer/SlidingWindowCounter.h"
+#include "../../JunCommon/system/ThreadPlacement.h"
 #include <vector>
 #include <thread>
 #include <functional>
 #include <memory>
 #include <atomic>
 #include <stdexcept>
+#include <algorithm>
 
 enum class PQCS
 {
@@ -41,12 +44,72 @@ private:
     bool enableMonitoring = false;
     std::vector<TimeWindowCounter<uint64_t>*> recvCounters;
     std::vector<TimeWindowCounter<uint64_t>*> sendCounters;
-    
+
+    // Busy-poll (저지연 모드) - 블로킹 전 spin 대기 시간 (0 = 비활성)
+    DWORD busyPollSpinUs = 0;
+
+    // Worker 스레드 CPU/NUMA 배치 (Worker 순번 기준)
+    ThreadPlacement workerPlacement;
+
+    // Worker별 통계 (false sharing 방지용 캐시라인 정렬)
+    struct alignas(64) WorkerStats
+    {
+        std::atomic<uint64_t> spinHits{0};       // spin 중 완료를 얻은 횟수
+        std::atomic<uint64_t> blockingWaits{0};  // spin 실패 후 블로킹 대기한 횟수
+        std::atomic<uint64_t> busyNs{0};         // 완료 처리에 쓴 누적 시간 (적응형 풀 전용)
+        std::atomic<bool> busy{false};           // 현재 완료 처리 중 여부 (적응형 풀 전용)
+    };
+    std::unique_ptr<WorkerStats[]> workerStats;
+
+    // 적응형 Worker 풀 (minWorkers == maxWorkers 이면 고정 크기, 컨트롤러 없음)
+    int minWorkers = 0;
+    int maxWorkers = 0;
+    DWORD adaptiveIntervalMs = 0;
+    int spawnedWorkers = 0;                      // 생성된 Worker 스레드 수 (컨트롤러/생성자만 변경)
+    std::atomic<int> activeWorkers{0};           // 완료를 처리 중인(park되지 않은) Worker 수
+    std::atomic<int> parkedWorkers{0};
+    std::atomic<uint64_t> scaleUpCount{0};
+    std::atomic<uint64_t> scaleDownCount{0};
+    std::atomic<double> lastUtilization{0.0};
+    std::atomic<double> lastSaturation{0.0};
+    HANDLE parkSemaphore = NULL;                 // park된 Worker 대기용
+    HANDLE controllerStopEvent = NULL;
+    std::thread controllerThread;
+
+    // Worker park 요청 (PQCS completionKey로 구분, overlapped는 nullptr)
+    static constexpr ULONG_PTR WORKER_PARK_KEY = static_cast<ULONG_PTR>(-1);
+
+    // 조정 기준 (구간 평균)
+    static constexpr double SCALE_UP_UTILIZATION   = 0.75;  // 활성 Worker 평균 busy 비율이 이 이상이면 증설
+    static constexpr double SCALE_UP_SATURATION    = 0.5;   // 전원 busy 샘플 비율이 이 이상이면 증설 (큐 적체)
+    static constexpr double SCALE_DOWN_UTILIZATION = 0.25;  // 이 이하이면 1개 park
+    static constexpr DWORD  SATURATION_SAMPLE_MS   = 50;
+
+public:
+    // 적응형 Worker 풀 상태 (GetWorkerPoolStats)
+    struct WorkerPoolStats
+    {
+        int activeWorkers;
+        int parkedWorkers;
+        int threadCount;
+        int minWorkers;
+        int maxWorkers;
+        uint64_t scaleUpCount;
+        uint64_t scaleDownCount;
+        double utilization;  // 직전 구간 활성 Worker 평균 busy 비율 (0.0 ~ 1.0)
+        double saturation;   // 직전 구간 활성 Worker 전원이 busy였던 샘플 비율 (큐 적체 추정치)
+    };
+
 public:
     class Builder {
     private:
         int workerCount = 5;
         bool enableMonitoring = false;
+        DWORD busyPollSpinUs = 0;
+        int minWorkers = 0;
+        int maxWorkers = 0;
+        DWORD adaptiveIntervalMs = 1000;
+        ThreadPlacement workerPlacement;
         
     public:
         Builder& WithWorkerCount(int count) 
@@ -60,10 +123,38 @@ public:
             enableMonitoring = enable;
             return *this;
         }
+
+        // Worker가 블로킹 전 spinMicroseconds 동안 완료를 polling (여유 코어로 wake-up 지연 제거)
+        Builder& WithBusyPoll(DWORD spinMicroseconds = 50)
+        {
+            busyPollSpinUs = spinMicroseconds;
+            return *this;
+        }
+
+        // 부하에 따라 Worker를 [min, max] 범위에서 증설/park (WithWorkerCount는 초기 개수로 사용)
+        Builder& WithAdaptiveWorkers(int minCount, int maxCount, DWORD intervalMs = 1000)
+        {
+            minWorkers = minCount;
+            maxWorkers = maxCount;
+            adaptiveIntervalMs = intervalMs;
+            return *this;
+        }
+
+        // Worker 스레드 코어 고정 / NUMA 노드 배치 (적응형 풀의 증설 Worker에도 적용)
+        Builder& WithWorkerPlacement(const ThreadPlacement& placement)
+        {
+            workerPlacement = placement;
+            return *this;
+        }
         
         std::unique_ptr<IOCPManager> Build() 
         {
-            return std::unique_ptr<IOCPManager>(new IOCPManager(workerCount, enableMonitoring));
+            // 적응형 미설정 시 min == max == workerCount (고정 크기)
+            const int minCount = (0 < minWorkers) ? minWorkers : workerCount;
+            const int maxCount = (0 < maxWorkers) ? (std::max)(maxWorkers, minCount) : (std::max)(workerCount, minCount);
+            const int initialCount = (std::min)((std::max)(workerCount, minCount), maxCount);
+
+            return std::unique_ptr<IOCPManager>(new IOCPManager(initialCount, enableMonitoring, busyPollSpinUs, minCount, maxCount, adaptiveIntervalMs, workerPlacement));
         }
     };
     
@@ -71,7 +162,7 @@ public:
 
 private:
     // Builder를 통해서만 생성될 수 있음
-    explicit IOCPManager(int workerCount, bool enableMonitoring);
+    explicit IOCPManager(int workerCount, bool enableMonitoring, DWORD busyPollSpinUs, int minWorkers, int maxWorkers, DWORD adaptiveIntervalMs, const ThreadPlacement& workerPlacement);
     
 public:
     ~IOCPManager();
@@ -97,11 +188,31 @@ public:
 	double GetSendBytesPerSecond(int seconds) const;
     bool IsMonitoringEnabled() const noexcept { return enableMonitoring; }
 
+    // Busy-poll 통계 (전체 Worker 합산)
+    bool IsBusyPollEnabled() const noexcept { return 0 < busyPollSpinUs; }
+    uint64_t GetSpinHitCount() const;
+    uint64_t GetBlockingWaitCount() const;
+
+    // 적응형 Worker 풀 상태
+    bool IsAdaptiveWorkersEnabled() const noexcept { return minWorkers < maxWorkers; }
+    WorkerPoolStats GetWorkerPoolStats() const;
+
 private:
     //------------------------------
     // IOCP Worker Thread - 패킷 조립 전담
     //------------------------------
-    void RunWorkerThread();
+    void RunWorkerThread(int workerIndex);
+    void SpawnWorker();
+
+    // 완료 대기 (busy-poll 설정 시 spin 후 블로킹)
+    BOOL WaitCompletion(WorkerStats& stats, DWORD* ioSize, ULONG_PTR* completionKey, OverlappedEx** overlapped);
+
+    //------------------------------
+    // 적응형 Worker 풀 컨트롤러
+    //------------------------------
+    void RunWorkerController();
+    void ScaleUp();
+    void ScaleDown();
     
     //------------------------------
     // IOCP 이벤트 처리
@@ -110,30 +221,57 @@ private:
     void HandleSendComplete(Session* session);
     void HandleAcceptComplete(Session* session, DWORD ioSize);
     void HandleConnectComplete(Session* session, DWORD ioSize);
+
+    //------------------------------
+    // 수신 제한 (IngressLimit)
+    //------------------------------
+    bool CheckIngressLimit(NetBase* engine, Session* session, uint32_t packet_id, IngressAction& outAction, DWORD& outWaitMs);
+    void ScheduleRecvResume(Session* session, DWORD delayMs);
 };
 
 //------------------------------
 // 인라인 구현
 //------------------------------
 
-inline IOCPManager::IOCPManager(int workerCount, bool enableMonitoring) 
+inline IOCPManager::IOCPManager(int workerCount, bool enableMonitoring, DWORD busyPollSpinUs, int minWorkers, int maxWorkers, DWORD adaptiveIntervalMs, const ThreadPlacement& workerPlacement) 
     : iocpHandle(CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, 0))
     , enableMonitoring(enableMonitoring)
+    , busyPollSpinUs(busyPollSpinUs)
+    , workerPlacement(workerPlacement)
+    , workerStats(std::make_unique<WorkerStats[]>(maxWorkers))
+    , minWorkers(minWorkers)
+    , maxWorkers(maxWorkers)
+    , adaptiveIntervalMs(adaptiveIntervalMs)
 {
     if (iocpHandle == NULL) 
     {
         throw std::runtime_error("CreateIoCompletionPort failed");
     }
     
-    // 통계 카운터 벡터 초기화
-    recvCounters.resize(workerCount, nullptr);
-    sendCounters.resize(workerCount, nullptr);
+    // 통계 카운터 벡터 초기화 (최대 Worker 수 기준, 미생성 Worker는 nullptr)
+    recvCounters.resize(maxWorkers, nullptr);
+    sendCounters.resize(maxWorkers, nullptr);
+
+    if (IsAdaptiveWorkersEnabled())
+    {
+        parkSemaphore = CreateSemaphore(NULL, 0, LONG_MAX, NULL);
+        controllerStopEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+        if (parkSemaphore == NULL || controllerStopEvent == NULL)
+        {
+            throw std::runtime_error("CreateSemaphore/CreateEvent failed");
+        }
+    }
     
     // Worker threads 생성
-    workerThreads.reserve(workerCount);
+    workerThreads.reserve(maxWorkers);
     for (int i = 0; i < workerCount; ++i) 
     {
-        workerThreads.emplace_back([this]() { RunWorkerThread(); });
+        SpawnWorker();
+    }
+
+    if (IsAdaptiveWorkersEnabled())
+    {
+        controllerThread = std::thread([this]() { RunWorkerController(); });
     }
 }
 
@@ -153,6 +291,17 @@ inline void IOCPManager::Shutdown()
     {
         return;
     }
+
+    // 컨트롤러 정지 후 park된 Worker 깨우기 (깨어난 Worker는 shutdown 확인 후 종료)
+    if (controllerThread.joinable())
+    {
+        SetEvent(controllerStopEvent);
+        controllerThread.join();
+    }
+    if (parkSemaphore != NULL)
+    {
+        ReleaseSemaphore(parkSemaphore, maxWorkers, NULL);
+    }
     
     // 모든 워커 스레드에 종료 신호 전송
     for (size_t i = 0; i < workerThreads.size(); ++i) 
@@ -169,6 +318,17 @@ inline void IOCPManager::Shutdown()
         }
     }
     workerThreads.clear();
+
+    if (parkSemaphore != NULL)
+    {
+        CloseHandle(parkSemaphore);
+        parkSemaphore = NULL;
+    }
+    if (controllerStopEvent != NULL)
+    {
+        CloseHandle(controllerStopEvent);
+        controllerStopEvent = NULL;
+    }
     
     // IOCP 핸들 정리
     if (iocpHandle != INVALID_HANDLE_VALUE) 
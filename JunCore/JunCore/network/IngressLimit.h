@@ -0,0 +1,126 @@
+﻿#pragma once
+#include "../core/WindowsIncludes.h"
+#include <cstdint>
+#include <unordered_map>
+
+//------------------------------
+// 수신(ingress) 제한 - 토큰 버킷
+// 프레이밍 단계(파싱 전)에서 세션/패킷 타입별로 적용
+//------------------------------
+
+// 제한 초과 시 처리 방식
+enum class IngressAction : uint8_t
+{
+	DEFER,			// 처리 보류 (토큰 충전까지 Recv 중단 -> TCP 수준 backpressure)
+	DROP,			// 패킷 폐기 (파싱하지 않음)
+	DISCONNECT,		// 연결 종료
+};
+
+struct IngressLimit
+{
+	double ratePerSec	= 0.0;					// 초당 허용 패킷 수 (0 = 제한 없음)
+	double burst		= 0.0;					// 버킷 최대 토큰 수 (0이면 ratePerSec 사용)
+	IngressAction action = IngressAction::DEFER;
+
+	bool IsEnabled() const { return 0.0 < ratePerSec; }
+	double Capacity() const { return 0.0 < burst ? burst : ratePerSec; }
+};
+
+struct TokenBucket
+{
+	double tokens		= 0.0;
+	ULONGLONG lastTick	= 0;
+
+	// 경과 시간만큼 토큰 충전 (첫 호출 시 가득 채움)
+	void Refill(const IngressLimit& limit, ULONGLONG nowMs)
+	{
+		if (lastTick == 0)
+		{
+			tokens = limit.Capacity();
+		}
+		else if (lastTick < nowMs)
+		{
+			tokens += (nowMs - lastTick) * limit.ratePerSec / 1000.0;
+			if (limit.Capacity() < tokens)
+			{
+				tokens = limit.Capacity();
+			}
+		}
+		lastTick = nowMs;
+	}
+
+	bool HasToken() const { return 1.0 <= tokens; }
+	void Consume() { tokens -= 1.0; }
+
+	// 토큰 1개가 찰 때까지 남은 시간 (ms)
+	DWORD MsUntilToken(const IngressLimit& limit) const
+	{
+		if (HasToken())
+		{
+			return 0;
+		}
+		return static_cast<DWORD>((1.0 - tokens) * 1000.0 / limit.ratePerSec) + 1;
+	}
+
+	void Reset()
+	{
+		tokens = 0.0;
+		lastTick = 0;
+	}
+};
+
+//------------------------------
+// IngressLimiter - 세션 하나의 수신 제한 상태 (세션 전체 버킷 + 패킷 타입별 버킷)
+// 세션의 Recv 완료는 한 번에 한 Worker만 처리하므로 lock 불필요
+//------------------------------
+struct IngressLimiter
+{
+	TokenBucket sessionBucket;
+	std::unordered_map<uint32_t, TokenBucket> typeBuckets;
+
+	// 패킷 1개 통과 여부 (typeLimit: 해당 패킷 타입 제한, 없으면 nullptr)
+	// 타입 버킷 -> 세션 버킷 순으로 확인, 둘 다 통과해야 둘 다 소모
+	// 실패 시 막은 쪽의 action과 토큰 1개가 찰 때까지 남은 시간(ms)
+	bool TryAcquire(const IngressLimit& sessionLimit, const IngressLimit* typeLimit, uint32_t packet_id, ULONGLONG nowMs, IngressAction& outAction, DWORD& outWaitMs)
+	{
+		// 1. 패킷 타입별 버킷
+		TokenBucket* typeBucket = nullptr;
+		if (typeLimit && typeLimit->IsEnabled())
+		{
+			typeBucket = &typeBuckets[packet_id];
+			typeBucket->Refill(*typeLimit, nowMs);
+			if (!typeBucket->HasToken())
+			{
+				outAction = typeLimit->action;
+				outWaitMs = typeBucket->MsUntilToken(*typeLimit);
+				return false;
+			}
+		}
+
+		// 2. 세션 전체 버킷
+		if (sessionLimit.IsEnabled())
+		{
+			sessionBucket.Refill(sessionLimit, nowMs);
+			if (!sessionBucket.HasToken())
+			{
+				outAction = sessionLimit.action;
+				outWaitMs = sessionBucket.MsUntilToken(sessionLimit);
+				return false;
+			}
+			sessionBucket.Consume();
+		}
+
+		// 두 버킷 모두 통과한 경우에만 타입 버킷 소모
+		if (typeBucket)
+		{
+			typeBucket->Consume();
+		}
+		return true;
+	}
+
+	void Reset()
+	{
+		sessionBucket.Reset();
+		typeBuckets.clear();
+	}
+};
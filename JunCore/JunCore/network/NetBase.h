@@ -12,6 +12,8 @@
 #include "../protocol/UnifiedPacketHeader.h"
 #include <functional>
 #include <unordered_map>
+#include <atomic>
+#include <mutex>
 
 class NetBase
 {
@@ -35,6 +37,17 @@ public:
 	double GetRecvBytesPerSecond(int seconds) const;
 	double GetSendBytesPerSecond(int seconds) const;
 	bool IsMonitoringEnabled() const;
+	IOCPManager::WorkerPoolStats GetWorkerPoolStats() const;
+
+    // 수신 제한 통계
+    uint64_t GetIngressDeferredCount() const { return ingress_deferred_count_.load(); }
+    uint64_t GetIngressDroppedCount() const { return ingress_dropped_count_.load(); }
+    uint64_t GetIngressDisconnectCount() const { return ingress_disconnect_count_.load(); }
+
+    // 수신 패킷 캡처 (시작 이후 연결된 세션의 수신 프레임을 파일에 기록, PacketCaptureReader로 재생)
+    bool StartPacketCapture(const std::string& path);
+    void StopPacketCapture();
+    std::shared_ptr<PacketCaptureWriter> GetPacketCapture() const;
 
 protected:
     // 패킷 핸들 등록
@@ -42,6 +55,17 @@ protected:
     void RegisterPacketHandler(std::function<void(User&, const T&)> handler);
     virtual void RegisterPacketHandlers() = 0;
 
+    // 메시지 타입별 송신 우선순위 등록 (RegisterPacketHandlers()에서 호출, 미등록 타입은 NORMAL)
+    // 레인이 다르면 순서가 바뀌므로 서로 순서에 의존하는 타입(같은 대상의 입장/이동/전투 등)은 같은 레인으로
+    template<typename T>
+    void RegisterSendPriority(SendPriority priority);
+
+    // 수신 제한 등록 (RegisterPacketHandlers()에서 호출)
+    // 세션 전체 + 패킷 타입별 토큰 버킷, 프레이밍 단계에서 파싱 전에 적용
+    void SetSessionIngressLimit(const IngressLimit& limit) { session_ingress_limit_ = limit; }
+    template<typename T>
+    void RegisterIngressLimit(const IngressLimit& limit);
+
 	//------------------------------
     // 서버/클라 공용 가상함수 - 사용자가 재정의
     //------------------------------
@@ -51,11 +75,32 @@ private:
     // 패킷 핸들 caller
 	void OnPacketReceived(Session* session, uint32_t packet_id, const std::vector<char>& payload);
 
+	// 세션 소멸 통지 (Session 소멸자에서 호출)
+	virtual void OnSessionRelease(Session* session) {}
+
+	// 송신 우선순위 조회 (Session::EnqueueSend에서 호출)
+	SendPriority GetSendPriority(uint32_t packet_id) const;
+
+	// 패킷 타입별 수신 제한 조회 (없으면 nullptr)
+	const IngressLimit* FindIngressLimit(uint32_t packet_id) const;
+
 protected:
 	std::shared_ptr<IOCPManager> iocpManager;
 	std::unordered_map<uint32_t, PacketHandler> packet_handlers_;
+	std::unordered_map<uint32_t, SendPriority> send_priorities_;	// Initialize 이후 읽기 전용
+
+	// 수신 제한 (Initialize 이후 읽기 전용)
+	IngressLimit session_ingress_limit_;
+	std::unordered_map<uint32_t, IngressLimit> ingress_limits_;
+	std::atomic<uint64_t> ingress_deferred_count_{0};
+	std::atomic<uint64_t> ingress_dropped_count_{0};
+	std::atomic<uint64_t> ingress_disconnect_count_{0};
 
 	bool initialized_ = false;
+
+	// 패킷 캡처
+	mutable std::mutex capture_lock_;
+	std::shared_ptr<PacketCaptureWriter> packet_capture_;
 };
 
 inline NetBase::NetBase(std::shared_ptr<IOCPManager> manager) : iocpManager(manager)
@@ -146,4 +191,77 @@ inline double NetBase::GetSendBytesPerSecond(int seconds) const
 inline bool NetBase::IsMonitoringEnabled() const
 {
     return iocpManager->IsMonitoringEnabled();
+}
+
+inline bool NetBase::StartPacketCapture(const std::string& path)
+{
+    auto writer = std::make_shared<PacketCaptureWriter>();
+    if (!writer->Open(path))
+    {
+        LOG_ERROR("Failed to open packet capture file: %s", path.c_str());
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(capture_lock_);
+    if (packet_capture_)
+    {
+        packet_capture_->Close();
+    }
+    packet_capture_ = std::move(writer);
+
+    LOG_INFO("Packet capture started: %s", path.c_str());
+    return true;
+}
+
+inline void NetBase::StopPacketCapture()
+{
+    std::shared_ptr<PacketCaptureWriter> writer;
+    {
+        std::lock_guard<std::mutex> lock(capture_lock_);
+        writer = std::move(packet_capture_);
+    }
+
+    // 세션들이 참조를 들고 있어도 Close 이후 기록은 무시됨
+    if (writer)
+    {
+        LOG_INFO("Packet capture stopped: %llu frames, %llu bytes", writer->GetFrameCount(), writer->GetByteCount());
+        writer->Close();
+    }
+}
+
+inline std::shared_ptr<PacketCaptureWriter> NetBase::GetPacketCapture() const
+{
+    std::lock_guard<std::mutex> lock(capture_lock_);
+    return packet_capture_;
+}
+
+inline IOCPManager::WorkerPoolStats NetBase::GetWorkerPoolStats() const
+{
+    return iocpManager->GetWorkerPoolStats();
+}
+
+template<typename T>
+void NetBase::RegisterSendPriority(SendPriority priority)
+{
+    const std::string type_name = T::descriptor()->full_name();
+    send_priorities_[fnv1a(type_name.c_str())] = priority;
+}
+
+inline SendPriority NetBase::GetSendPriority(uint32_t packet_id) const
+{
+    auto it = send_priorities_.find(packet_id);
+    return it != send_priorities_.end() ? it->second : SendPriority::NORMAL;
+}
+
+template<typename T>
+void NetBase::RegisterIngressLimit(const IngressLimit& limit)
+{
+    const std::string type_name = T::descriptor()->full_name();
+    ingress_limits_[fnv1a(type_name.c_str())] = limit;
+}
+
+inline const IngressLimit* NetBase::FindIngressLimit(uint32_t packet_id) const
+{
+    auto it = ingress_limits_.find(packet_id);
+    return it != ingress_limits_.end() ? &it->second : nullptr;
 }
\ No newline at end of file
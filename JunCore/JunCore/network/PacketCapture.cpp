@@ -0,0 +1,239 @@
+﻿#include "PacketCapture.h"
+#include "../protocol/UnifiedPacketHeader.h"
+#include <unordered_set>
+#include <algorithm>
+
+//------------------------------
+// PacketCaptureWriter
+//------------------------------
+
+PacketCaptureWriter::~PacketCaptureWriter()
+{
+    Close();
+}
+
+bool PacketCaptureWriter::Open(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(lock_);
+
+    if (file_ != nullptr)
+    {
+        return false;
+    }
+
+    if (fopen_s(&file_, path.c_str(), "wb") != 0 || file_ == nullptr)
+    {
+        file_ = nullptr;
+        return false;
+    }
+    setvbuf(file_, nullptr, _IOFBF, WRITE_BUFFER_SIZE);
+
+    PacketCaptureFileHeader header = {};
+    header.magic = PACKET_CAPTURE_MAGIC;
+    header.version = PACKET_CAPTURE_VERSION;
+    header.start_unix_ms = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+
+    if (fwrite(&header, sizeof(header), 1, file_) != 1)
+    {
+        fclose(file_);
+        file_ = nullptr;
+        return false;
+    }
+
+    start_time_ = std::chrono::steady_clock::now();
+    frame_count_ = 0;
+    byte_count_ = 0;
+    is_open_.store(true, std::memory_order_release);
+    return true;
+}
+
+void PacketCaptureWriter::Close()
+{
+    std::lock_guard<std::mutex> lock(lock_);
+
+    is_open_.store(false, std::memory_order_release);
+    if (file_ != nullptr)
+    {
+        fflush(file_);
+        fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+uint32_t PacketCaptureWriter::OpenStream()
+{
+    const uint32_t stream_id = next_stream_id_.fetch_add(1);
+    WriteRecord(CaptureRecordType::SESSION_OPEN, stream_id, nullptr, 0);
+    return stream_id;
+}
+
+void PacketCaptureWriter::CloseStream(uint32_t stream_id)
+{
+    WriteRecord(CaptureRecordType::SESSION_CLOSE, stream_id, nullptr, 0);
+}
+
+void PacketCaptureWriter::WriteFrame(uint32_t stream_id, const char* frame, uint32_t length)
+{
+    WriteRecord(CaptureRecordType::FRAME, stream_id, frame, length);
+    frame_count_.fetch_add(1, std::memory_order_relaxed);
+    byte_count_.fetch_add(length, std::memory_order_relaxed);
+}
+
+void PacketCaptureWriter::WriteRecord(CaptureRecordType type, uint32_t stream_id, const char* data, uint32_t length)
+{
+    if (!IsOpen())
+    {
+        return;
+    }
+
+    // 타임스탬프는 lock 안에서 찍어 파일 내 순서와 시간 순서를 일치시킴
+    std::lock_guard<std::mutex> lock(lock_);
+    if (file_ == nullptr)
+    {
+        return;
+    }
+
+    PacketCaptureRecord record;
+    record.type = static_cast<uint8_t>(type);
+    record.stream_id = stream_id;
+    record.timestamp_us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_time_).count());
+    record.length = length;
+
+    fwrite(&record, sizeof(record), 1, file_);
+    if (0 < length)
+    {
+        fwrite(data, 1, length, file_);
+    }
+}
+
+//------------------------------
+// PacketCaptureReader
+//------------------------------
+
+PacketCaptureReader::~PacketCaptureReader()
+{
+    Close();
+}
+
+bool PacketCaptureReader::Open(const std::string& path)
+{
+    Close();
+
+    if (fopen_s(&file_, path.c_str(), "rb") != 0 || file_ == nullptr)
+    {
+        file_ = nullptr;
+        return false;
+    }
+
+    PacketCaptureFileHeader header;
+    if (fread(&header, sizeof(header), 1, file_) != 1 ||
+        header.magic != PACKET_CAPTURE_MAGIC ||
+        header.version != PACKET_CAPTURE_VERSION)
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void PacketCaptureReader::Close()
+{
+    if (file_ != nullptr)
+    {
+        fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+bool PacketCaptureReader::Next(CapturedRecord& out)
+{
+    if (file_ == nullptr)
+    {
+        return false;
+    }
+
+    PacketCaptureRecord record;
+    if (fread(&record, sizeof(record), 1, file_) != 1)
+    {
+        return false;
+    }
+
+    // 기록 중 종료되어 잘린 레코드/손상 방어
+    if (record.length != 0 && (record.type != static_cast<uint8_t>(CaptureRecordType::FRAME) || !IsValidPacketSize(record.length)))
+    {
+        return false;
+    }
+
+    out.type = static_cast<CaptureRecordType>(record.type);
+    out.stream_id = record.stream_id;
+    out.timestamp_us = record.timestamp_us;
+    out.frame.resize(record.length);
+
+    if (0 < record.length && fread(out.frame.data(), 1, record.length, file_) != record.length)
+    {
+        return false;
+    }
+    return true;
+}
+
+void PacketCaptureReader::Rewind()
+{
+    if (file_ != nullptr)
+    {
+        fseek(file_, sizeof(PacketCaptureFileHeader), SEEK_SET);
+    }
+}
+
+bool PacketCaptureReader::Summarize(const std::string& path, Summary& out)
+{
+    PacketCaptureReader reader;
+    if (!reader.Open(path))
+    {
+        return false;
+    }
+
+    out = Summary{};
+    std::unordered_set<uint32_t> streams;
+    std::unordered_set<uint32_t> openStreams;
+    bool first = true;
+    uint64_t firstTimestamp = 0;
+
+    PacketCaptureRecord record;
+    while (fread(&record, sizeof(record), 1, reader.file_) == 1)
+    {
+        if (first)
+        {
+            firstTimestamp = record.timestamp_us;
+            first = false;
+        }
+        out.duration_us = record.timestamp_us - firstTimestamp;
+
+        switch (static_cast<CaptureRecordType>(record.type))
+        {
+        case CaptureRecordType::SESSION_OPEN:
+            streams.insert(record.stream_id);
+            openStreams.insert(record.stream_id);
+            out.max_concurrent = (std::max)(out.max_concurrent, static_cast<uint32_t>(openStreams.size()));
+            break;
+        case CaptureRecordType::SESSION_CLOSE:
+            openStreams.erase(record.stream_id);
+            break;
+        case CaptureRecordType::FRAME:
+            ++out.frame_count;
+            out.byte_count += record.length;
+            break;
+        default:
+            return false;
+        }
+
+        if (0 < record.length && fseek(reader.file_, record.length, SEEK_CUR) != 0)
+        {
+            break;
+        }
+    }
+
+    out.stream_count = static_cast<uint32_t>(streams.size());
+    return true;
+}
@@ -0,0 +1,131 @@
+﻿#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+
+//------------------------------
+// 패킷 캡처 - 수신 프레임(UnifiedPacketHeader + payload) 기록/재생용 파일 포맷
+//
+// [FileHeader][Record][frame bytes][Record][frame bytes]...
+// - append-only, 레코드는 기록 순서 = 수신 순서 (전체 세션 통합 타임라인)
+// - stream_id: 캡처 내 세션 식별자 (OPEN ~ CLOSE 구간)
+// - 프레임은 수신 그대로 기록하므로 세션키로 암호화된 payload는 재생 시 의미가 없음
+//------------------------------
+
+constexpr uint32_t PACKET_CAPTURE_MAGIC   = 0x5041434A; // "JCAP"
+constexpr uint16_t PACKET_CAPTURE_VERSION = 1;
+
+enum class CaptureRecordType : uint8_t
+{
+    SESSION_OPEN    = 1,
+    FRAME           = 2,
+    SESSION_CLOSE   = 3,
+};
+
+#pragma pack(push, 1)
+struct PacketCaptureFileHeader
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t reserved;
+    uint64_t start_unix_ms;     // 캡처 시작 시각 (참고용)
+};
+
+struct PacketCaptureRecord
+{
+    uint8_t  type;              // CaptureRecordType
+    uint32_t stream_id;
+    uint64_t timestamp_us;      // 캡처 시작 기준 경과 시간
+    uint32_t length;            // 뒤따르는 프레임 바이트 수 (FRAME 외에는 0)
+};
+#pragma pack(pop)
+
+//------------------------------
+// PacketCaptureWriter - 여러 Worker에서 동시에 기록 (내부 lock + 버퍼링)
+//------------------------------
+class PacketCaptureWriter
+{
+public:
+    PacketCaptureWriter() = default;
+    ~PacketCaptureWriter();
+
+    PacketCaptureWriter(const PacketCaptureWriter&) = delete;
+    PacketCaptureWriter& operator=(const PacketCaptureWriter&) = delete;
+
+public:
+    bool Open(const std::string& path);
+    void Close();
+    bool IsOpen() const { return is_open_.load(std::memory_order_acquire); }
+
+    // 세션 단위 기록 (Session::Set / Release에서 호출)
+    uint32_t OpenStream();
+    void CloseStream(uint32_t stream_id);
+    void WriteFrame(uint32_t stream_id, const char* frame, uint32_t length);
+
+    uint64_t GetFrameCount() const { return frame_count_.load(std::memory_order_relaxed); }
+    uint64_t GetByteCount() const { return byte_count_.load(std::memory_order_relaxed); }
+
+private:
+    void WriteRecord(CaptureRecordType type, uint32_t stream_id, const char* data, uint32_t length);
+
+private:
+    static constexpr size_t WRITE_BUFFER_SIZE = 1024 * 1024;
+
+    std::mutex lock_;
+    FILE* file_ = nullptr;
+    std::atomic<bool> is_open_{false};
+    std::chrono::steady_clock::time_point start_time_;
+
+    std::atomic<uint32_t> next_stream_id_{1};
+    std::atomic<uint64_t> frame_count_{0};
+    std::atomic<uint64_t> byte_count_{0};
+};
+
+//------------------------------
+// PacketCaptureReader - 순차 읽기 (재생 드라이버용)
+//------------------------------
+struct CapturedRecord
+{
+    CaptureRecordType type;
+    uint32_t stream_id;
+    uint64_t timestamp_us;
+    std::vector<char> frame;    // FRAME 레코드만 채워짐
+};
+
+class PacketCaptureReader
+{
+public:
+    PacketCaptureReader() = default;
+    ~PacketCaptureReader();
+
+    PacketCaptureReader(const PacketCaptureReader&) = delete;
+    PacketCaptureReader& operator=(const PacketCaptureReader&) = delete;
+
+public:
+    bool Open(const std::string& path);
+    void Close();
+
+    // 다음 레코드 (파일 끝 또는 손상 시 false)
+    bool Next(CapturedRecord& out);
+
+    // 처음 레코드로 되감기
+    void Rewind();
+
+    // 캡처 전체를 훑어 통계 산출 (frame 내용은 읽지 않음)
+    struct Summary
+    {
+        uint32_t stream_count = 0;      // 서로 다른 stream 수
+        uint32_t max_concurrent = 0;    // 동시에 열린 stream 최대 수
+        uint64_t frame_count = 0;
+        uint64_t byte_count = 0;
+        uint64_t duration_us = 0;       // 첫 레코드 ~ 마지막 레코드
+    };
+    static bool Summarize(const std::string& path, Summary& out);
+
+private:
+    FILE* file_ = nullptr;
+};
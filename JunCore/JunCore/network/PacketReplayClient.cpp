@@ -0,0 +1,170 @@
+﻿#include "PacketReplayClient.h"
+#include "../log.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+PacketReplayClient::PacketReplayClient(std::shared_ptr<IOCPManager> manager,
+                                       const char* serverIP,
+                                       WORD port,
+                                       const std::string& capturePath,
+                                       int connectionCount)
+    : Client(manager, serverIP, port, connectionCount)
+    , capturePath_(capturePath)
+    , connectionCount_(connectionCount)
+{
+}
+
+int PacketReplayClient::GetRequiredConnectionCount(const std::string& capturePath)
+{
+    PacketCaptureReader::Summary summary;
+    if (!PacketCaptureReader::Summarize(capturePath, summary))
+    {
+        return 0;
+    }
+    return static_cast<int>(summary.max_concurrent);
+}
+
+ReplayResult PacketReplayClient::Replay(double speed, DWORD connectTimeoutMs)
+{
+    using Clock = std::chrono::steady_clock;
+    ReplayResult result;
+
+    PacketCaptureReader reader;
+    if (!reader.Open(capturePath_))
+    {
+        LOG_ERROR("Failed to open capture file: %s", capturePath_.c_str());
+        return result;
+    }
+
+    // 1. 재생 전 연결 확보 (부족하면 확보된 만큼으로 진행, 배정 못 한 stream은 skip 집계)
+    {
+        std::unique_lock<std::recursive_mutex> lock(lock_);
+        connectedCv_.wait_for(lock, std::chrono::milliseconds(connectTimeoutMs), [this]() {
+            return abort_.load() || static_cast<int>(idleUsers_.size()) >= connectionCount_;
+        });
+        if (static_cast<int>(idleUsers_.size()) < connectionCount_)
+        {
+            LOG_WARN("Replay starting with %d/%d connections", static_cast<int>(idleUsers_.size()), connectionCount_);
+        }
+    }
+
+    // 2. 캡처 타임라인 재현
+    CapturedRecord record;
+    bool first = true;
+    uint64_t firstTimestampUs = 0;
+    uint64_t lastTimestampUs = 0;
+    const auto replayStart = Clock::now();
+
+    while (!abort_.load() && reader.Next(record))
+    {
+        if (first)
+        {
+            firstTimestampUs = record.timestamp_us;
+            first = false;
+        }
+        lastTimestampUs = record.timestamp_us;
+
+        if (0.0 < speed)
+        {
+            const auto offsetUs = static_cast<long long>((record.timestamp_us - firstTimestampUs) / speed);
+            const auto due = replayStart + std::chrono::microseconds(offsetUs);
+            const auto now = Clock::now();
+            if (now < due)
+            {
+                std::this_thread::sleep_until(due);
+            }
+            else
+            {
+                result.maxLagMs = (std::max)(result.maxLagMs, std::chrono::duration<double, std::milli>(now - due).count());
+            }
+        }
+
+        std::lock_guard<std::recursive_mutex> lock(lock_);
+
+        switch (record.type)
+        {
+        case CaptureRecordType::SESSION_OPEN:
+        {
+            if (!idleUsers_.empty())
+            {
+                streamUsers_[record.stream_id] = idleUsers_.back();
+                idleUsers_.pop_back();
+                ++result.streamsReplayed;
+            }
+        } break;
+
+        case CaptureRecordType::FRAME:
+        {
+            auto it = streamUsers_.find(record.stream_id);
+            if (it != streamUsers_.end() && it->second->SendRawFrame(record.frame.data(), static_cast<uint32_t>(record.frame.size())))
+            {
+                ++result.framesSent;
+            }
+            else
+            {
+                ++result.framesSkipped;
+            }
+        } break;
+
+        case CaptureRecordType::SESSION_CLOSE:
+        {
+            // 연결 종료 -> Client가 재연결하여 유휴 연결로 보충됨
+            auto it = streamUsers_.find(record.stream_id);
+            if (it != streamUsers_.end())
+            {
+                User* user = it->second;
+                streamUsers_.erase(it);
+                user->Disconnect();
+            }
+        } break;
+        }
+    }
+
+    result.capturedSeconds = static_cast<double>(lastTimestampUs - firstTimestampUs) / 1000000.0;
+    result.elapsedSeconds = std::chrono::duration<double>(Clock::now() - replayStart).count();
+    result.completed = !abort_.load();
+
+    LOG_INFO("Replay %s: streams=%u, sent=%llu, skipped=%llu, captured=%.2fs, elapsed=%.2fs, maxLag=%.2fms",
+        result.completed ? "completed" : "aborted",
+        result.streamsReplayed, result.framesSent, result.framesSkipped,
+        result.capturedSeconds, result.elapsedSeconds, result.maxLagMs);
+    return result;
+}
+
+void PacketReplayClient::OnConnectComplete(User* user, bool success)
+{
+    if (!success)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::recursive_mutex> lock(lock_);
+        idleUsers_.push_back(user);
+    }
+    connectedCv_.notify_all();
+}
+
+void PacketReplayClient::OnUserDisconnect(User* user)
+{
+    {
+        std::lock_guard<std::recursive_mutex> lock(lock_);
+
+        idleUsers_.erase(std::remove(idleUsers_.begin(), idleUsers_.end(), user), idleUsers_.end());
+        for (auto it = streamUsers_.begin(); it != streamUsers_.end(); )
+        {
+            if (it->second == user)
+            {
+                it = streamUsers_.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    // 재연결 예약 + User 해제
+    Client::OnUserDisconnect(user);
+}
@@ -0,0 +1,67 @@
+﻿#pragma once
+#include "Client.h"
+#include "PacketCapture.h"
+#include <mutex>
+#include <condition_variable>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <atomic>
+
+//------------------------------
+// ReplayResult - PacketReplayClient::Replay() 결과
+//------------------------------
+struct ReplayResult
+{
+    uint32_t streamsReplayed = 0;   // 연결을 배정받은 캡처 stream 수
+    uint64_t framesSent      = 0;
+    uint64_t framesSkipped   = 0;   // 배정할 연결이 없어 보내지 못한 프레임
+    double capturedSeconds   = 0.0; // 캡처 구간 길이
+    double elapsedSeconds    = 0.0; // 실제 재생 소요 시간
+    double maxLagMs          = 0.0; // 예정 시각 대비 최대 지연 (재생 드라이버가 못 따라간 정도)
+    bool completed           = false;
+};
+
+//------------------------------
+// PacketReplayClient - 캡처 파일(PacketCaptureWriter)을 Client 연결로 재생
+// - 캡처 stream(서버 세션) 1개 = Client 연결 1개, OPEN 시 유휴 연결 배정, CLOSE 시 연결 종료 (자동 재연결로 보충)
+// - 캡처의 상대 타이밍을 speed 배율로 재현 (0 = 대기 없이 최대 속도)
+// - 서버 응답은 처리하지 않음 (로그 레벨을 WARN 이상으로 두고 사용)
+//------------------------------
+class PacketReplayClient : public Client
+{
+public:
+    PacketReplayClient(std::shared_ptr<IOCPManager> manager,
+                       const char* serverIP,
+                       WORD port,
+                       const std::string& capturePath,
+                       int connectionCount);
+
+    // 캡처 재생에 필요한 연결 수 (동시에 열린 stream 최대 수, 실패 시 0)
+    static int GetRequiredConnectionCount(const std::string& capturePath);
+
+public:
+    //------------------------------
+    // 재생 (StartClient() 이후 호출, 끝날 때까지 블로킹)
+    // speed: 1.0 = 원래 속도, 2.0 = 2배속, 0 = 최대 속도
+    // connectTimeoutMs: 재생 시작 전 연결 확보 대기 시간
+    //------------------------------
+    ReplayResult Replay(double speed, DWORD connectTimeoutMs = 10000);
+    void AbortReplay() { abort_.store(true); }
+
+protected:
+    void RegisterPacketHandlers() override {}
+    void OnConnectComplete(User* user, bool success) override;
+    void OnUserDisconnect(User* user) override;
+
+private:
+    std::string capturePath_;
+    int connectionCount_;
+    std::atomic<bool> abort_{false};
+
+    // SendRawFrame 중 세션이 해제되면 같은 스레드에서 OnUserDisconnect가 불릴 수 있어 recursive
+    std::recursive_mutex lock_;
+    std::condition_variable_any connectedCv_;
+    std::vector<User*> idleUsers_;                      // 연결됐고 stream에 배정되지 않은 User
+    std::unordered_map<uint32_t, User*> streamUsers_;   // 캡처 stream -> 배정된 User
+};
@@ -0,0 +1,137 @@
+﻿#include "SendQueue.h"
+
+SendQueue::~SendQueue()
+{
+	Clear();
+}
+
+void SendQueue::Enqueue(std::vector<char>* packet, SendPriority priority)
+{
+	// 추적 중인 병합 패킷이 있을 때만 표시 (없으면 추월당할 패킷도 없음)
+	// 같은 스레드에서 이어지는 EnqueueCoalesced는 이 증가를 반드시 봄
+	if (0 < coalesce_count_.load())
+	{
+		plain_seq_.fetch_add(1);
+	}
+
+	EnqueueLane(packet, priority);
+}
+
+void SendQueue::EnqueueLane(std::vector<char>* packet, SendPriority priority)
+{
+	lanes_[static_cast<int>(priority)].Enqueue(packet);
+}
+
+void SendQueue::EnqueueCoalesced(std::vector<char>* packet, SendPriority priority, uint64_t coalesce_key)
+{
+	{
+		std::lock_guard<std::mutex> lock(coalesce_lock_);
+		const uint64_t plainSeq = plain_seq_.load();
+
+		auto it = coalesce_pending_.find(coalesce_key);
+		if (it != coalesce_pending_.end())
+		{
+			CoalescedEntry& pending = it->second;
+			if (pending.plainSeq == plainSeq && pending.priority == priority)
+			{
+				// 아직 gather 되지 않았고 뒤에 일반 패킷도 없음 -> 내용만 최신으로 교체 (큐 깊이/대역폭 증가 없음)
+				pending.packet->swap(*packet);
+				delete packet;
+				return;
+			}
+
+			// 이전 패킷 뒤에 일반 패킷이 있음 -> 이전 패킷은 그 자리에서 그대로 나가고, 새 패킷을 뒤에 추적
+			coalesce_keys_.erase(pending.packet);
+			pending = CoalescedEntry{ packet, priority, plainSeq };
+		}
+		else
+		{
+			coalesce_pending_.emplace(coalesce_key, CoalescedEntry{ packet, priority, plainSeq });
+			coalesce_count_.fetch_add(1);
+		}
+		coalesce_keys_.emplace(packet, coalesce_key);
+	}
+
+	EnqueueLane(packet, priority);
+}
+
+int SendQueue::Gather(std::vector<char>** out, int max)
+{
+	int count = 0;
+
+	// 라운드마다 높은 우선순위 레인부터 SEND_LANE_WEIGHTS 만큼 꺼내므로 버스트 중에도 CRITICAL 패킷이 스트림 앞쪽에 위치
+	bool laneRemaining = true;
+	while (laneRemaining && count < max)
+	{
+		laneRemaining = false;
+		for (int lane = 0; lane < SEND_LANE_COUNT; lane++)
+		{
+			for (int taken = 0; taken < SEND_LANE_WEIGHTS[lane] && count < max; taken++)
+			{
+				if (!lanes_[lane].Dequeue(&out[count]))
+				{
+					break;
+				}
+				++count;
+			}
+
+			if (0 < lanes_[lane].GetUseCount())
+			{
+				laneRemaining = true;
+			}
+		}
+	}
+
+	// 병합 대상 패킷 추적 해제 후 버퍼 확정 (이후 내용 교체 불가)
+	if (0 < count && 0 < coalesce_count_.load())
+	{
+		UntrackCoalesced(out, count);
+	}
+
+	return count;
+}
+
+void SendQueue::UntrackCoalesced(std::vector<char>** packets, int count)
+{
+	// gather 된 패킷은 WSASend 동안 내용이 바뀌면 안 되므로 추적 해제
+	std::lock_guard<std::mutex> lock(coalesce_lock_);
+	for (int i = 0; i < count; i++)
+	{
+		auto it = coalesce_keys_.find(packets[i]);
+		if (it != coalesce_keys_.end())
+		{
+			coalesce_pending_.erase(it->second);
+			coalesce_keys_.erase(it);
+			coalesce_count_.fetch_sub(1);
+		}
+	}
+}
+
+int SendQueue::GetCount() const
+{
+	int count = 0;
+	for (const auto& lane : lanes_)
+	{
+		count += lane.GetUseCount();
+	}
+	return count;
+}
+
+void SendQueue::Clear()
+{
+	{
+		std::lock_guard<std::mutex> lock(coalesce_lock_);
+		coalesce_pending_.clear();
+		coalesce_keys_.clear();
+		coalesce_count_ = 0;
+	}
+
+	std::vector<char>* packet;
+	for (auto& lane : lanes_)
+	{
+		while (lane.Dequeue(&packet))
+		{
+			delete packet;  // vector<char> 메모리 해제
+		}
+	}
+}
@@ -0,0 +1,93 @@
+﻿#pragma once
+#include "../core/WindowsIncludes.h"
+#include "../../JunCommon/container/LFQueue.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+constexpr int MAX_SEND_MSG = 200;
+
+// 송신 우선순위 (레인) - 메시지 타입별로 NetBase::RegisterSendPriority<T>()에서 지정
+// 레인이 다르면 나중에 보낸 패킷이 먼저 나갈 수 있음
+// -> 같은 대상(플레이어 등)에 대한 상태 메시지(입장/퇴장/이동/전투)는 반드시 같은 레인에 둘 것
+enum class SendPriority : uint8_t
+{
+	CRITICAL = 0,	// 다른 메시지와 순서 의존이 없는 지연 민감 패킷
+	NORMAL,			// 기본값 (미등록 타입)
+	BULK,			// 다른 메시지와 순서 의존이 없는 대량 패킷
+	MAX
+};
+
+constexpr int SEND_LANE_COUNT = static_cast<int>(SendPriority::MAX);
+
+// Gather 한 라운드에서 레인별로 가져갈 최대 패킷 수 (가중 drain)
+constexpr int SEND_LANE_WEIGHTS[SEND_LANE_COUNT] = { 8, 4, 1 };
+
+// 병합(coalesce) 키 - (그룹, 대상 id). 그룹은 보통 메시지 타입의 packet_id
+// 같은 키의 미전송 패킷이 있으면 새 패킷이 그 내용을 대체 (조건은 SendQueue::EnqueueCoalesced)
+inline uint64_t MakeCoalesceKey(uint32_t group_id, uint32_t subject_id)
+{
+	return (static_cast<uint64_t>(group_id) << 32) | subject_id;
+}
+
+//------------------------------
+// SendQueue - 세션 송신 대기열 (우선순위 레인 + 병합)
+// 소켓과 무관한 정책 부분만 Session에서 분리 (단위 테스트 가능)
+// - Enqueue: 아무 스레드 (레인별 LFQueue)
+// - Gather: send_flag_를 잡은 스레드 하나만 (WSASend 직전)
+// - 순서: 같은 레인 안에서는 넣은 순서 그대로, 레인 사이는 가중 라운드 로빈으로 섞임
+//------------------------------
+class SendQueue
+{
+public:
+	SendQueue() = default;
+	~SendQueue();
+
+	SendQueue(const SendQueue&) = delete;
+	SendQueue& operator=(const SendQueue&) = delete;
+
+	void Enqueue(std::vector<char>* packet, SendPriority priority);
+
+	//------------------------------
+	// 같은 키의 미전송 패킷이 있으면 내용만 교체 (새 패킷은 해제됨, 큐 위치는 이전 패킷 자리)
+	// 단, 이전 패킷 뒤로 일반 패킷(Enqueue)이 하나라도 들어왔거나 레인이 다르면 교체하지 않고
+	// 이전 패킷은 그대로 두고 새 패킷을 맨 뒤에 넣음
+	// -> 새 내용이 나중에 보낸 일반 패킷(같은 대상의 DISAPPEAR/APPEAR 등)을 추월하지 않음
+	//    (일반 패킷은 대상을 모르므로 어떤 대상이든 보수적으로 교체를 끊음)
+	// 서로 다른 키의 병합 패킷끼리는 앞뒤가 바뀔 수 있음 (다른 대상이거나 같은 대상의 대체 가능한 상태)
+	//------------------------------
+	void EnqueueCoalesced(std::vector<char>* packet, SendPriority priority, uint64_t coalesce_key);
+
+	// 레인별 가중치만큼씩 높은 우선순위부터 돌아가며 최대 max개를 out에 꺼냄
+	// 꺼낸 패킷은 병합 추적에서 빠지므로 이후 내용이 바뀌지 않음 (해제는 호출자)
+	int Gather(std::vector<char>** out, int max);
+
+	// 모든 레인의 대기 패킷 수
+	int GetCount() const;
+
+	// 남은 패킷 해제 + 병합 추적 초기화 (세션 재사용 시)
+	void Clear();
+
+private:
+	struct CoalescedEntry
+	{
+		std::vector<char>* packet;
+		SendPriority priority;
+		uint64_t plainSeq;		// 넣을 당시의 plain_seq_ (달라졌으면 뒤에 일반 패킷이 들어온 것)
+	};
+
+	void EnqueueLane(std::vector<char>* packet, SendPriority priority);
+	void UntrackCoalesced(std::vector<char>** packets, int count);
+
+private:
+	LFQueue<std::vector<char>*> lanes_[SEND_LANE_COUNT];
+
+	// 병합 - 키별 미전송 패킷 추적
+	std::mutex coalesce_lock_;
+	std::unordered_map<uint64_t, CoalescedEntry> coalesce_pending_;	// 키 -> 미전송 패킷
+	std::unordered_map<std::vector<char>*, uint64_t> coalesce_keys_;	// 미전송 패킷 -> 키
+	std::atomic<int> coalesce_count_ = 0;							// 추적 중인 패킷 수 (0이면 lock 생략)
+	std::atomic<uint64_t> plain_seq_ = 0;							// 추적 중인 패킷이 있을 때 들어온 일반 패킷 수
+};
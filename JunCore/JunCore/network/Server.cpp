@@ -82,10 +82,12 @@ bool Server::StartServer(const char* bindIP, WORD port, DWORD maxSessions)
 
         // 초기 AcceptEx 등록
         running = true;
+        accepting_ = true;
         if (!PostAcceptEx())
         {
             LOG_ERROR("Failed to post initial AcceptEx");
             running = false;
+            accepting_ = false;
             closesocket(listenSocket);
             StopGameThreads();
             return false;
@@ -116,14 +118,123 @@ void Server::StopServer()
     StopGameThreads();
 
     // 리슨 소켓 정리
+    CloseListenSocket();
+
+    // 사용자 콜백 호출
+    OnServerStop();
+}
+
+void Server::CloseListenSocket()
+{
+    accepting_ = false;
+
     if (listenSocket != INVALID_SOCKET)
     {
         closesocket(listenSocket);
         listenSocket = INVALID_SOCKET;
     }
+}
 
-    // 사용자 콜백 호출
-    OnServerStop();
+int Server::GetSessionCount() const
+{
+    std::lock_guard<std::mutex> lock(sessionsLock_);
+    return static_cast<int>(sessions_.size());
+}
+
+void Server::RegisterSession(const std::shared_ptr<Session>& session)
+{
+    std::lock_guard<std::mutex> lock(sessionsLock_);
+    sessions_[session.get()] = session;
+}
+
+void Server::OnSessionRelease(Session* session)
+{
+    std::lock_guard<std::mutex> lock(sessionsLock_);
+    sessions_.erase(session);
+}
+
+DrainResult Server::DrainServerImpl(const std::function<void(Session&)>& sendGoodbye, DWORD timeoutMs)
+{
+    constexpr DWORD DRAIN_POLL_INTERVAL_MS = 10;
+
+    DrainResult result;
+    if (!running.load())
+    {
+        LOG_WARN("DrainServer called but server is not running");
+        return result;
+    }
+
+    const ULONGLONG startTick = GetTickCount64();
+    const ULONGLONG deadline  = startTick + timeoutMs;
+
+    // 1. 신규 연결 차단 (LB 헬스체크 실패 -> 신규 유입 중단)
+    CloseListenSocket();
+
+    // 2. 현재 세션 스냅샷
+    std::vector<std::shared_ptr<Session>> sessions;
+    {
+        std::lock_guard<std::mutex> lock(sessionsLock_);
+        sessions.reserve(sessions_.size());
+        for (auto& [ptr, weak] : sessions_)
+        {
+            if (auto session = weak.lock())
+            {
+                sessions.push_back(std::move(session));
+            }
+        }
+    }
+    result.sessionCount = static_cast<int>(sessions.size());
+    LOG_INFO("Drain started: %d sessions, timeout %lu ms", result.sessionCount, timeoutMs);
+
+    // 3. 작별 메시지 송신
+    if (sendGoodbye)
+    {
+        for (auto& session : sessions)
+        {
+            sendGoodbye(*session);
+        }
+    }
+
+    // 4. 기한 내 송신 큐 flush 대기 (이미 끊긴 세션은 flush 완료로 간주)
+    std::vector<std::shared_ptr<Session>> pending = sessions;
+    while (!pending.empty() && GetTickCount64() < deadline)
+    {
+        std::erase_if(pending, [](const std::shared_ptr<Session>& session)
+        {
+            return session->pending_disconnect_.load() || session->IsSendIdle();
+        });
+
+        if (!pending.empty())
+        {
+            Sleep(DRAIN_POLL_INTERVAL_MS);
+        }
+    }
+    result.flushedCount = result.sessionCount - static_cast<int>(pending.size());
+    pending.clear();
+
+    // 5. 세션 종료 (flush 되지 못한 세션도 기한 도달 시 종료)
+    for (auto& session : sessions)
+    {
+        session->Disconnect();
+    }
+    sessions.clear();
+
+    // 6. 세션 정리 대기 (남은 기한 내)
+    while (0 < GetSessionCount() && GetTickCount64() < deadline)
+    {
+        Sleep(DRAIN_POLL_INTERVAL_MS);
+    }
+
+    result.remainingCount = GetSessionCount();
+    result.elapsedMs      = static_cast<DWORD>(GetTickCount64() - startTick);
+    result.completed      = (result.flushedCount == result.sessionCount && result.remainingCount == 0);
+
+    LOG_INFO("Drain %s: flushed %d/%d, remaining %d, elapsed %lu ms",
+             result.completed ? "completed" : "timed out",
+             result.flushedCount, result.sessionCount, result.remainingCount, result.elapsedMs);
+
+    OnServerDrained(result);
+    return result;
 }
 
 void Server::StartGameThreads()
@@ -153,6 +264,54 @@ void Server::StopGameThreads()
     core_thread_->Stop();
 }
 
+JobStatsReport Server::TakeJobStats()
+{
+    JobStatsReport report;
+    report.coreThread = core_thread_->TakeJobStats();
+    report.gameThreads.reserve(game_threads_.size());
+    for (auto& thread : game_threads_)
+    {
+        report.gameThreads.push_back(thread->TakeJobStats());
+    }
+    report.types = JobStats::TakeTypeSnapshots();
+    return report;
+}
+
+void Server::SetGameThreadPlacement(const ThreadPlacement& placement)
+{
+    for (int i = 0; i < static_cast<int>(game_threads_.size()); ++i)
+    {
+        game_threads_[i]->SetPlacement(placement, i);
+    }
+}
+
+void Server::SetCoreThreadPlacement(const ThreadPlacement& placement)
+{
+    core_thread_->SetPlacement(placement, 0);
+}
+
+void Server::SetCoreThreadCount(int count)
+{
+    if (core_thread_->IsRunning())
+    {
+        LOG_WARN("Server::SetCoreThreadCount ignored: core thread already running");
+        return;
+    }
+
+    // 이미 지정된 배치 정책은 유지
+    const ThreadPlacement placement = core_thread_->GetPlacement();
+
+    if (count > 1)
+    {
+        core_thread_ = std::make_unique<JobThreadPool>(count);
+    }
+    else
+    {
+        core_thread_ = std::make_unique<JobThread>();
+    }
+    core_thread_->SetPlacement(placement, 0);
+}
+
 GameThread* Server::GetGameThread(int index)
 {
     if (index < 0 || index >= static_cast<int>(game_threads_.size()))
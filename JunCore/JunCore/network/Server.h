@@ -5,11 +5,15 @@
 #include "Session.h"
 #include "../../JunCommon/container/LFStack.h"
 #include "../logic/JobThread.h"
+#include "../logic/JobThreadPool.h"
 #include "../logic/GameThread.h"
 #include <thread>
 #include <atomic>
 #include <memory>
 #include <vector>
+#include <mutex>
+#include <unordered_map>
+#include <functional>
 #include <mswsock.h>
 
 // AcceptEx 함수 포인터 타입 정의
@@ -36,6 +40,18 @@ typedef VOID(WINAPI* LPFN_GETACCEPTEXSOCKADDRS)(
     LPINT RemoteSockaddrLength
 );
 
+//------------------------------
+// DrainResult - DrainServer() 결과 보고
+//------------------------------
+struct DrainResult
+{
+    int sessionCount    = 0;        // drain 시작 시점 세션 수
+    int flushedCount    = 0;        // 기한 내 송신 큐를 모두 비운 세션 수
+    int remainingCount  = 0;        // 기한 내 종료되지 않은 세션 수
+    DWORD elapsedMs     = 0;        // drain 소요 시간
+    bool completed      = false;    // 모든 세션이 기한 내 flush + 종료되었는지
+};
+
 class Server : public NetBase
 {
     friend class IOCPManager; // IOCPManager가 private 멤버에 접근할 수 있도록
@@ -55,6 +71,17 @@ public:
     void StopServer();
     bool IsServerRunning() const noexcept { return running.load(); }
 
+    //------------------------------
+    // Graceful drain (롤링 재시작용)
+    // 1. 신규 연결 차단  2. 작별 메시지 송신  3. 기한 내 송신 큐 flush  4. 세션 종료
+    // GameThread는 유지되므로 drain 이후 StopServer() 호출
+    //------------------------------
+    template<typename T>
+    DrainResult DrainServer(const T& goodbyePacket, DWORD timeoutMs);
+    DrainResult DrainServer(DWORD timeoutMs);
+    bool IsAccepting() const noexcept { return accepting_.load(); }
+    int GetSessionCount() const;
+
     //------------------------------
     // GameThread 관리
     //------------------------------
@@ -63,6 +90,25 @@ public:
     GameThread* GetGameThread(int index);
     int GetGameThreadCount() const { return static_cast<int>(game_threads_.size()); }
 
+    //------------------------------
+    // CPU/NUMA 배치 정책 (StartServer 전에 호출)
+    // GameThread i는 정책의 i번째 코어에 배치, 코어 JobThread는 별도 정책
+    //------------------------------
+    void SetGameThreadPlacement(const ThreadPlacement& placement);
+    void SetCoreThreadPlacement(const ThreadPlacement& placement);
+
+    //------------------------------
+    // 코어 스레드 수 (StartServer 전에 호출)
+    // 2 이상이면 시스템 매니저들을 워크 스틸링 JobThreadPool에서 처리
+    //------------------------------
+    void SetCoreThreadCount(int count);
+
+    //------------------------------
+    // Job 처리 계측 수거 (JobStats::SetEnabled 동안 쌓인 값, 꺼내고 초기화)
+    // 코어 스레드 / GameThread별 / JobObject 타입별
+    //------------------------------
+    JobStatsReport TakeJobStats();
+
 protected:
     //------------------------------
     // 서버 전용 가상함수 - 사용자가 재정의
@@ -70,6 +116,7 @@ protected:
 	virtual void OnSessionConnect(User* user) = 0;
     virtual void OnServerStart() {}
     virtual void OnServerStop() {}
+    virtual void OnServerDrained(const DrainResult& result) {}
 
 private:
     //------------------------------
@@ -80,6 +127,11 @@ private:
 
     // Accept 관리
     std::atomic<bool> running{false};
+    std::atomic<bool> accepting_{false};
+
+    // 연결된 세션 목록 (drain 용)
+    mutable std::mutex sessionsLock_;
+    std::unordered_map<Session*, std::weak_ptr<Session>> sessions_;
 
     // AcceptEx 함수 포인터들
     LPFN_ACCEPTEX fnAcceptEx = nullptr;
@@ -88,8 +140,9 @@ private:
     //------------------------------
     // 코어 JobThread (시스템 매니저들 공유)
     // GameObjectManager, GuildManager 등이 사용
+    // SetCoreThreadCount(2 이상) 시 JobThreadPool
     //------------------------------
-    std::unique_ptr<JobThread> core_thread_;
+    std::unique_ptr<JobThreadBase> core_thread_;
 
     //------------------------------
     // GameThread 관리
@@ -102,6 +155,11 @@ private:
     //------------------------------
     bool LoadAcceptExFunctions();
     bool PostAcceptEx();
+    void CloseListenSocket();
+
+    void RegisterSession(const std::shared_ptr<Session>& session);
+    void OnSessionRelease(Session* session) override;
+    DrainResult DrainServerImpl(const std::function<void(Session&)>& sendGoodbye, DWORD timeoutMs);
 };
 
 //------------------------------
@@ -125,4 +183,15 @@ inline Server::Server(std::shared_ptr<IOCPManager> manager, int game_thread_coun
 inline Server::~Server()
 {
     StopServer();
+}
+
+template<typename T>
+inline DrainResult Server::DrainServer(const T& goodbyePacket, DWORD timeoutMs)
+{
+    return DrainServerImpl([&goodbyePacket](Session& session) { session.SendPacket(goodbyePacket); }, timeoutMs);
+}
+
+inline DrainResult Server::DrainServer(DWORD timeoutMs)
+{
+    return DrainServerImpl(nullptr, timeoutMs);
 }
\ No newline at end of file
@@ -13,6 +13,11 @@
 Session::Session() {}
 Session::~Session()
 {
+	if (engine_)
+	{
+		engine_->OnSessionRelease(this);
+	}
+
 	if (engine_ && owner_user_)
 	{
 		engine_->OnUserDisconnect(owner_user_);
@@ -39,12 +44,51 @@ void Session::Set(SOCKET sock, in_addr ip, WORD port, NetBase* eng, HANDLE iocp_
 	h_iocp_				= iocp_handle;
 	owner_user_			= user;
 
+	// 이전 연결의 캡처 구간 종료 후 새 연결 캡처 시작
+	if (capture_)
+	{
+		capture_->CloseStream(capture_stream_id_);
+		capture_.reset();
+		capture_stream_id_ = 0;
+	}
+	if (eng && sock != INVALID_SOCKET)
+	{
+		capture_ = eng->GetPacketCapture();
+		if (capture_)
+		{
+			capture_stream_id_ = capture_->OpenStream();
+		}
+	}
+
 	recv_buf_.Clear();
-	std::vector<char>* packet_data;
-	while (send_q_.Dequeue(&packet_data)) 
+	ingress_limiter_.Reset();
+	send_q_.Clear();
+}
+
+void Session::EnqueueSend(std::vector<char>* packet_data, uint32_t packet_id)
+{
+	const SendPriority priority = engine_ ? engine_->GetSendPriority(packet_id) : SendPriority::NORMAL;
+	send_q_.Enqueue(packet_data, priority);
+}
+
+bool Session::SendRawFrame(const char* frame, uint32_t length)
+{
+	if (sock_ == INVALID_SOCKET || pending_disconnect_ || length < UNIFIED_HEADER_SIZE)
 	{
-		delete packet_data;  // vector<char> 메모리 해제
+		return false;
 	}
+
+	const uint32_t packet_id = reinterpret_cast<const UnifiedPacketHeader*>(frame)->packet_id;
+	EnqueueSend(new std::vector<char>(frame, frame + length), packet_id);
+
+	SendAsync();
+	return true;
+}
+
+void Session::EnqueueCoalescedSend(std::vector<char>* packet_data, uint32_t packet_id, uint64_t coalesce_key)
+{
+	const SendPriority priority = engine_ ? engine_->GetSendPriority(packet_id) : SendPriority::NORMAL;
+	send_q_.EnqueueCoalesced(packet_data, priority, coalesce_key);
 }
 
 void Session::Release()
@@ -61,9 +105,7 @@ void Session::Release()
 void Session::SendAsyncImpl()
 {
     WSABUF wsaBuf[MAX_SEND_MSG];
-    int preparedCount = 0;
-
-    const auto size = send_q_.GetUseCount();
+    const auto size = GetSendQueueCount();
     if (MAX_SEND_MSG < size)
     {
 		LOG_ERROR("send_q_ overflow. count : %d", size);
@@ -71,19 +113,9 @@ void Session::SendAsyncImpl()
         return;
     }
 
-    for (int i = 0; i < MAX_SEND_MSG; i++)
-    {
-        if (send_q_.GetUseCount() <= 0) 
-		{
-            break;
-        }
-
-        send_q_.Dequeue(&send_packet_arr_[i]);
-        ++preparedCount;
-
-        wsaBuf[i].buf = send_packet_arr_[i]->data();
-        wsaBuf[i].len = static_cast<DWORD>(send_packet_arr_[i]->size());
-    }
+    // 가중 라운드 로빈으로 gather 목록 구성 (병합 추적도 여기서 해제되어 이후 버퍼 확정)
+    // 같은 레인 안에서는 순서 유지, 레인 사이는 섞임 (SendPriority 참고)
+    const int preparedCount = send_q_.Gather(send_packet_arr_, MAX_SEND_MSG);
 
     // 보낼 것이 없으면 실패
     if (preparedCount == 0) 
@@ -93,6 +125,12 @@ void Session::SendAsyncImpl()
         return;
     }
 
+    for (int i = 0; i < preparedCount; i++)
+    {
+        wsaBuf[i].buf = send_packet_arr_[i]->data();
+        wsaBuf[i].len = static_cast<DWORD>(send_packet_arr_[i]->size());
+    }
+
     // 준비된 패킷 수 커밋
     send_packet_count_ = preparedCount;
 
@@ -5,14 +5,16 @@
 #include "../../JunCommon/container/RingBuffer.h"
 #include "../core/base.h"
 #include "../protocol/UnifiedPacketHeader.h"
+#include "IngressLimit.h"
+#include "PacketCapture.h"
+#include "SendQueue.h"
 #include <vector>
 #include <string>
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include "IOCPManager.h"
 
-constexpr int MAX_SEND_MSG = 200;
-
 class Session;
 
 enum class IOOperation : uint8_t
@@ -21,7 +23,8 @@ enum class IOOperation : uint8_t
 	IO_SEND,
 	IO_ACCEPT,
 	IO_CONNECT,
-	IO_DISCONNECT
+	IO_DISCONNECT,
+	IO_RECV_RESUME,	// 수신 제한(DEFER)으로 보류된 프레이밍 재개
 };
 
 struct OverlappedEx
@@ -75,7 +78,7 @@ public:
 	std::atomic<bool> pending_disconnect_ = false;
 
 	// Send
-	LFQueue<std::vector<char>*> send_q_;				// 송신 대기 큐 (raw 데이터)
+	SendQueue send_q_;									// 송신 대기 큐 (우선순위 레인 + 병합, raw 데이터)
 	std::vector<char>* send_packet_arr_[MAX_SEND_MSG];	// 현재 전송중인 패킷 벡터들
 	LONG send_packet_count_ = 0;						// 현재 전송중인 패킷 개수
 
@@ -85,9 +88,19 @@ public:
 	// TimeOut
 	DWORD last_recv_time_;
 
+	// 수신 제한 (세션 전체 + 패킷 타입별 버킷)
+	IngressLimiter ingress_limiter_;
+
 	// 암호화
 	std::vector<char> aes_key_;
 
+	// Client 연결 슬롯 (Client 세션만 사용, 재연결 스케줄링용)
+	int connect_slot_ = -1;
+
+	// 패킷 캡처 (Set 시점에 엔진이 캡처 중이면 연결, 세션 종료까지 유지)
+	std::shared_ptr<PacketCaptureWriter> capture_;
+	uint32_t capture_stream_id_ = 0;
+
 private:
 	HANDLE h_iocp_ = INVALID_HANDLE_VALUE;  // IOCP 핸들 저장
 	class NetBase* engine_ = nullptr;       // 이 세션을 소유한 엔진
@@ -103,6 +116,12 @@ public:
 	inline class NetBase* GetEngine() const { return engine_; }
 	
 	inline class User* GetOwnerUser() const { return owner_user_; }
+
+	// 송신 큐가 비어 있고 진행 중인 WSASend도 없는지
+	inline bool IsSendIdle() const { return GetSendQueueCount() <= 0 && !send_flag_.load(); }
+
+	// 모든 레인의 송신 대기 패킷 수
+	inline int GetSendQueueCount() const { return send_q_.GetCount(); }
 	
 	inline void Disconnect() noexcept
 	{
@@ -117,21 +136,34 @@ public:
 	// Send
 	template<typename T>
 	bool SendPacket(const T& packet);
+	template<typename T>
+	bool SendCoalescedPacket(const T& packet, uint64_t coalesce_key);	// 같은 키의 미전송 패킷을 대체
+	void EnqueueSend(std::vector<char>* packet_data, uint32_t packet_id);
+	void EnqueueCoalescedSend(std::vector<char>* packet_data, uint32_t packet_id, uint64_t coalesce_key);
+	bool SendRawFrame(const char* frame, uint32_t length);	// 직렬화된 프레임(헤더 포함) 그대로 송신 (캡처 재생용)
 	void SendAsync();
 	void SendAsyncImpl();
 	// Recv
 	bool RecvAsync();
+
+	// 수신 프레임 캡처 (IOCPManager 프레이밍 단계에서 호출)
+	inline void CaptureInbound(const char* frame, uint32_t length)
+	{
+		if (capture_)
+		{
+			capture_->WriteFrame(capture_stream_id_, frame, length);
+		}
+	}
+
+private:
+	template<typename T>
+	static std::vector<char>* SerializePacket(const T& packet, uint32_t& out_packet_id);
 };
 typedef Session* PSession;
 
 template<typename T>
-inline bool Session::SendPacket(const T& packet)
+inline std::vector<char>* Session::SerializePacket(const T& packet, uint32_t& out_packet_id)
 {
-    if (sock_ == INVALID_SOCKET || pending_disconnect_) 
-    {
-        return false;
-    }
-    
     // 1. 프로토버프 메시지 직렬화 크기 계산
     size_t payload_size = packet.ByteSizeLong();
     size_t total_size   = UNIFIED_HEADER_SIZE + payload_size;
@@ -152,13 +184,54 @@ inline bool Session::SendPacket(const T& packet)
     if (!packet.SerializeToArray(packet_data->data() + sizeof(UnifiedPacketHeader), payload_size))
     {
         delete packet_data;
+        return nullptr;
+    }
+
+    out_packet_id = packet_id;
+    return packet_data;
+}
+
+template<typename T>
+inline bool Session::SendPacket(const T& packet)
+{
+    if (sock_ == INVALID_SOCKET || pending_disconnect_) 
+    {
+        return false;
+    }
+
+    uint32_t packet_id;
+    std::vector<char>* packet_data = SerializePacket(packet, packet_id);
+    if (!packet_data)
+    {
+        return false;
+    }
+
+	// 송신 큐에 패킷 추가 (타입별 우선순위 레인)
+	EnqueueSend(packet_data, packet_id);
+
+	// Send flag 체크 후 비동기 송신 시작
+	SendAsync();
+	return true;
+}
+
+template<typename T>
+inline bool Session::SendCoalescedPacket(const T& packet, uint64_t coalesce_key)
+{
+    if (sock_ == INVALID_SOCKET || pending_disconnect_) 
+    {
+        return false;
+    }
+
+    uint32_t packet_id;
+    std::vector<char>* packet_data = SerializePacket(packet, packet_id);
+    if (!packet_data)
+    {
         return false;
     }
 
-	// 6. 송신 큐에 패킷 추가
-	send_q_.Enqueue(packet_data);
+	// 같은 키의 미전송 패킷이 있으면 대체, 없으면 송신 큐에 추가
+	EnqueueCoalescedSend(packet_data, packet_id, coalesce_key);
 
-	// 7. Send flag 체크 후 비동기 송신 시작
 	SendAsync();
 	return true;
 }
@@ -168,14 +241,14 @@ inline void Session::SendAsync()
 	bool expected = false;
 	if (send_flag_.compare_exchange_strong(expected, true))
 	{
-		if (0 < send_q_.GetUseCount())
+		if (0 < GetSendQueueCount())
 		{
 			SendAsyncImpl();
 		}
 		else
 		{
 			send_flag_.store(false);
-			if (0 < send_q_.GetUseCount())
+			if (0 < GetSendQueueCount())
 			{
 				SendAsync();
 			}
@@ -2,6 +2,8 @@
 #include "Session.h"
 #include <memory>
 
+namespace google { namespace protobuf { class Message; } }
+
 //------------------------------
 // User - Session의 안전한 래퍼 클래스
 // weak_ptr을 사용하여 Session 생명주기 관리
@@ -10,7 +12,7 @@ class User
 {
 public:
     explicit User(std::weak_ptr<Session> session);
-    ~User() = default;
+    virtual ~User() = default;
 
     // 복사/이동 허용 (weak_ptr은 안전)
     User(const User&) = default;
@@ -25,6 +27,13 @@ public:
     template<typename T>
     bool SendPacket(const T& packet);
 
+    // 같은 coalesce_key의 미전송 패킷을 대체 (MakeCoalesceKey 참고)
+    template<typename T>
+    bool SendCoalescedPacket(const T& packet, uint64_t coalesce_key);
+
+    // 직렬화된 프레임(헤더 포함) 그대로 송신 (캡처 재생용)
+    bool SendRawFrame(const char* frame, uint32_t length);
+
     //------------------------------
     // 연결 상태 확인
     //------------------------------
@@ -54,6 +63,17 @@ public:
     void SetSpawnPos(float x, float y, float z);
     void GetSpawnPos(float& x, float& y, float& z) const;
 
+protected:
+    User() = default;   // 세션 없는 User (파생 클래스 전용)
+
+    //------------------------------
+    // 세션이 없을 때의 송신 / 연결 상태 (기본: 실패)
+    // 세션 없이 도는 파생 User(헤드리스 시뮬레이션)가 재정의, 세션이 있으면 거치지 않음
+    // coalesce_key: SendCoalescedPacket이면 해당 키, 아니면 0
+    //------------------------------
+    virtual bool SendWithoutSession(uint32_t packet_id, const google::protobuf::Message& packet, uint64_t coalesce_key) { return false; }
+    virtual bool IsConnectedWithoutSession() const { return false; }
+
 private:
     std::weak_ptr<Session> session_;
     class Player* player_{nullptr};  // 게임 로직 플레이어 객체
@@ -80,9 +100,27 @@ inline bool User::SendPacket(const T& packet)
     {
         return session->SendPacket(packet);
     }
-    return false;
+    return SendWithoutSession(PACKET_ID(T), packet, 0);
 }
 
+template<typename T>
+inline bool User::SendCoalescedPacket(const T& packet, uint64_t coalesce_key)
+{
+    if (auto session = session_.lock()) 
+    {
+        return session->SendCoalescedPacket(packet, coalesce_key);
+    }
+    return SendWithoutSession(PACKET_ID(T), packet, coalesce_key);
+}
+
+inline bool User::SendRawFrame(const char* frame, uint32_t length)
+{
+    if (auto session = session_.lock()) 
+    {
+        return session->SendRawFrame(frame, length);
+    }
+    return false;
+}
 
 inline bool User::IsConnected() const
 {
@@ -90,7 +128,7 @@ inline bool User::IsConnected() const
     {
         return session->sock_ != INVALID_SOCKET && !session->pending_disconnect_;
     }
-    return false;
+    return IsConnectedWithoutSession();
 }
 
 inline void User::Disconnect()
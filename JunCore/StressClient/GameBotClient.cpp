@@ -0,0 +1,659 @@
+﻿#define _WINSOCK_DEPRECATED_NO_WARNINGS
+#include "GameBotClient.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <cstdio>
+
+namespace
+{
+	constexpr int MONITOR_INTERVAL_SECONDS = 5;
+	constexpr int64_t PENDING_TIMEOUT_US = 5 * 1000 * 1000;	// 응답 없는 요청 폐기 (사망 후 공격 등 서버가 무응답 처리)
+	constexpr float MAP_EDGE_MARGIN = 1.0f;
+
+	float ClampToMap(float v)
+	{
+		return (std::clamp)(v, BOT_MAP_MIN + MAP_EDGE_MARGIN, BOT_MAP_MAX - MAP_EDGE_MARGIN);
+	}
+
+	void SetPos(game::Pos* pos, float x, float z)
+	{
+		pos->set_x(x);
+		pos->set_y(0.0f);
+		pos->set_z(z);
+	}
+
+	// 대기 중인 요청이 있으면 지연 기록 후 대기 해제
+	void RecordLatency(LatencyHistogram& histogram, int64_t& sentUs, int64_t nowUs)
+	{
+		if (sentUs == 0)
+		{
+			return;
+		}
+		histogram.Record(static_cast<uint64_t>((std::max)(int64_t{0}, nowUs - sentUs)));
+		sentUs = 0;
+	}
+}
+
+bool GameBotConfig::ParsePattern(const char* name, CrowdPattern& out)
+{
+	if (strcmp(name, "uniform") == 0)		{ out = CrowdPattern::UNIFORM; return true; }
+	if (strcmp(name, "cluster") == 0)		{ out = CrowdPattern::CLUSTER; return true; }
+	if (strcmp(name, "border") == 0)		{ out = CrowdPattern::BORDER; return true; }
+	return false;
+}
+
+const char* GameBotConfig::PatternName(CrowdPattern pattern)
+{
+	switch (pattern)
+	{
+	case CrowdPattern::UNIFORM:	return "uniform";
+	case CrowdPattern::CLUSTER:	return "cluster";
+	case CrowdPattern::BORDER:	return "border";
+	}
+	return "unknown";
+}
+
+GameBotClient::GameBotClient(std::shared_ptr<IOCPManager> manager, const GameBotConfig& config)
+	: Client(manager, config.serverIP.c_str(), config.serverPort, config.botCount)
+	, config_(config)
+{
+	ConnectRampConfig ramp;
+	ramp.connectsPerSecond = config_.connectsPerSecond;
+	SetConnectRamp(ramp);
+}
+
+GameBotClient::~GameBotClient()
+{
+	StopBots();
+}
+
+void GameBotClient::RegisterPacketHandlers()
+{
+	RegisterBotHandler<game::GC_LOGIN_RES>(&GameBotClient::HandleLoginRes);
+	RegisterBotHandler<game::GC_SCENE_ENTER_NOTIFY>(&GameBotClient::HandleSceneEnter);
+	RegisterBotHandler<game::GC_MOVE_NOTIFY>(RECV_MOVE, &GameBotClient::HandleMoveNotify);
+	RegisterBotHandler<game::GC_MOVE_STOP_NOTIFY>(RECV_MOVE_STOP, &GameBotClient::HandleMoveStopNotify);
+	RegisterBotHandler<game::GC_PLAYER_APPEAR_NOTIFY>(RECV_APPEAR, &GameBotClient::HandleAppearNotify);
+	RegisterBotHandler<game::GC_PLAYER_DISAPPEAR_NOTIFY>(RECV_DISAPPEAR, &GameBotClient::HandleDisappearNotify);
+	RegisterBotHandler<game::GC_ATTACK_NOTIFY>(RECV_ATTACK, &GameBotClient::HandleAttackNotify);
+	RegisterBotHandler<game::GC_DAMAGE_NOTIFY>(RECV_DAMAGE, &GameBotClient::HandleDamageNotify);
+	RegisterBotHandler<game::GC_POSITION_SYNC_NOTIFY>(RECV_POSITION_SYNC, &GameBotClient::HandlePositionSync);
+	RegisterBotHandler<game::GC_ERROR_NOTIFY>(RECV_ERROR, &GameBotClient::HandleError);
+}
+
+void GameBotClient::OnClientStart()
+{
+	if (running_.exchange(true))
+	{
+		LOG_WARN("[GameBot] Already running!");
+		return;
+	}
+
+	LOG_INFO("[GameBot] Starting %d bots (pattern: %s) on %d driver threads...",
+		config_.botCount, GameBotConfig::PatternName(config_.pattern), config_.driverThreadCount);
+
+	bots_ = std::make_unique<GameBot[]>(config_.botCount);
+	for (int i = 0; i < config_.botCount; i++)
+	{
+		bots_[i].slot = i;
+	}
+	{
+		std::unique_lock<std::shared_mutex> lock(slotLock_);
+		userSlots_.clear();
+		freeSlots_.clear();
+		for (int i = config_.botCount - 1; i >= 0; --i)
+		{
+			freeSlots_.push_back(i);
+		}
+	}
+
+	// 봇 행동 타이머는 씬 입장 시 등록
+	StartTimerDriver(config_.driverThreadCount, [this](int slot, uint32_t generation, Clock::time_point)
+	{
+		return OnActionTimer(slot, generation);
+	});
+	monitorThread_ = std::thread(&GameBotClient::MonitorThreadFunc, this);
+}
+
+void GameBotClient::OnClientStop()
+{
+	StopBots();
+}
+
+void GameBotClient::StopBots()
+{
+	if (!running_.exchange(false))
+	{
+		return;
+	}
+
+	LOG_INFO("[GameBot] Stopping bots...");
+
+	if (monitorThread_.joinable())
+	{
+		monitorThread_.join();
+	}
+	StopTimerDriver();
+
+	for (int slot = 0; slot < config_.botCount; slot++)
+	{
+		GameBot& bot = bots_[slot];
+		std::lock_guard<std::recursive_mutex> lock(bot.lock);
+		if (bot.user)
+		{
+			bot.user->Disconnect();
+		}
+	}
+
+	LOG_INFO("[GameBot] Bots stopped.");
+}
+
+int GameBotClient::FindSlot(User* user)
+{
+	std::shared_lock<std::shared_mutex> lock(slotLock_);
+	auto it = userSlots_.find(user);
+	return (it != userSlots_.end()) ? it->second : -1;
+}
+
+void GameBotClient::ResetBot(GameBot& bot)
+{
+	// bot.lock 보유 상태에서 호출
+	bot.user = nullptr;
+	bot.state = BotState::IDLE;
+	bot.playerId = 0;
+	bot.dead = false;
+	bot.nearby.clear();
+	bot.loginSentUs = 0;
+	bot.sceneReadySentUs = 0;
+	bot.moveSentUs = 0;
+	bot.attackSentUs = 0;
+}
+
+void GameBotClient::OnConnectComplete(User* user, bool success)
+{
+	if (!success)
+	{
+		LOG_ERROR("[GameBot] Failed to connect to server");
+		return;
+	}
+
+	int slot = -1;
+	{
+		std::unique_lock<std::shared_mutex> lock(slotLock_);
+		if (!freeSlots_.empty())
+		{
+			slot = freeSlots_.back();
+			freeSlots_.pop_back();
+			userSlots_[user] = slot;
+		}
+	}
+
+	if (slot < 0)
+	{
+		LOG_ERROR("[GameBot] No free bot slot for 0x%llX", (uintptr_t)user);
+		user->Disconnect();
+		return;
+	}
+
+	connectedCount_.fetch_add(1);
+
+	GameBot& bot = bots_[slot];
+	std::lock_guard<std::recursive_mutex> lock(bot.lock);
+	ResetBot(bot);
+	bot.user = user;
+	bot.state = BotState::LOGIN_SENT;
+	bot.loginSentUs = NowMicros();
+	SendBotPacket(bot, game::CG_LOGIN_REQ{});
+}
+
+void GameBotClient::OnUserDisconnect(User* user)
+{
+	int slot = -1;
+	{
+		std::unique_lock<std::shared_mutex> lock(slotLock_);
+		auto it = userSlots_.find(user);
+		if (it != userSlots_.end())
+		{
+			slot = it->second;
+			userSlots_.erase(it);
+		}
+	}
+
+	if (0 <= slot)
+	{
+		GameBot& bot = bots_[slot];
+		{
+			std::lock_guard<std::recursive_mutex> lock(bot.lock);
+			if (bot.state == BotState::IN_GAME)
+			{
+				inGameCount_.fetch_sub(1);
+			}
+			ResetBot(bot);
+		}
+
+		connectedCount_.fetch_sub(1);
+		{
+			std::unique_lock<std::shared_mutex> lock(slotLock_);
+			freeSlots_.push_back(slot);
+		}
+	}
+
+	// 부모 클래스에서 User 삭제 및 재연결 처리
+	Client::OnUserDisconnect(user);
+}
+
+//------------------------------
+// 패킷 핸들러 (bot.lock 보유 상태에서 호출)
+//------------------------------
+void GameBotClient::HandleLoginRes(GameBot& bot, const game::GC_LOGIN_RES& packet)
+{
+	RecordLatency(loginLatency_, bot.loginSentUs, NowMicros());
+
+	bot.playerId = packet.player_id();
+	bot.x = bot.destX = packet.spawn_pos().x();
+	bot.z = bot.destZ = packet.spawn_pos().z();
+
+	// 씬 로딩은 즉시 완료로 간주
+	bot.state = BotState::SCENE_READY_SENT;
+	bot.sceneReadySentUs = NowMicros();
+	SendBotPacket(bot, game::CG_SCENE_READY_REQ{});
+}
+
+void GameBotClient::HandleSceneEnter(GameBot& bot, const game::GC_SCENE_ENTER_NOTIFY& packet)
+{
+	RecordLatency(enterLatency_, bot.sceneReadySentUs, NowMicros());
+
+	if (bot.state != BotState::IN_GAME)
+	{
+		inGameCount_.fetch_add(1);
+	}
+	bot.state = BotState::IN_GAME;
+	bot.x = bot.destX = packet.spawn_pos().x();
+	bot.z = bot.destZ = packet.spawn_pos().z();
+
+	// 첫 행동은 간격 내 무작위 오프셋으로 분산
+	const auto now = Clock::now();
+	std::uniform_int_distribution<> offsetDist(0, (std::max)(0, config_.actionIntervalMs - 1));
+	bot.lastPositionUpdate = now;
+	bot.nextActionTime = now + std::chrono::milliseconds(offsetDist(bot.rng));
+	ScheduleTimer(bot.slot, ++bot.actionGeneration, bot.nextActionTime);
+}
+
+void GameBotClient::HandleMoveNotify(GameBot& bot, const game::GC_MOVE_NOTIFY& packet)
+{
+	if (packet.player_id() == bot.playerId)
+	{
+		RecordLatency(moveLatency_, bot.moveSentUs, NowMicros());
+		return;
+	}
+
+	KnownPlayer& other = bot.nearby[packet.player_id()];
+	other.x = packet.cur_pos().x();
+	other.z = packet.cur_pos().z();
+}
+
+void GameBotClient::HandleMoveStopNotify(GameBot& bot, const game::GC_MOVE_STOP_NOTIFY& packet)
+{
+	if (packet.player_id() == bot.playerId)
+	{
+		// 공격 대기 중 본인 정지 알림 = 서버가 공격을 거부 (RejectAttack)
+		if (bot.attackSentUs != 0)
+		{
+			bot.attackSentUs = 0;
+			attackRejected_.fetch_add(1, std::memory_order_relaxed);
+		}
+		bot.x = bot.destX = packet.position().x();
+		bot.z = bot.destZ = packet.position().z();
+		bot.lastPositionUpdate = Clock::now();
+		return;
+	}
+
+	KnownPlayer& other = bot.nearby[packet.player_id()];
+	other.x = packet.position().x();
+	other.z = packet.position().z();
+}
+
+void GameBotClient::HandleAppearNotify(GameBot& bot, const game::GC_PLAYER_APPEAR_NOTIFY& packet)
+{
+	for (const auto& info : packet.players())
+	{
+		if (info.player_id() == bot.playerId)
+		{
+			continue;
+		}
+
+		KnownPlayer& other = bot.nearby[info.player_id()];
+		other.x = info.position().x();
+		other.z = info.position().z();
+		other.dead = (info.hp() <= 0);
+	}
+}
+
+void GameBotClient::HandleDisappearNotify(GameBot& bot, const game::GC_PLAYER_DISAPPEAR_NOTIFY& packet)
+{
+	bot.nearby.erase(packet.player_id());
+}
+
+void GameBotClient::HandleAttackNotify(GameBot& bot, const game::GC_ATTACK_NOTIFY& packet)
+{
+	if (packet.attacker_id() == bot.playerId)
+	{
+		RecordLatency(attackLatency_, bot.attackSentUs, NowMicros());
+		return;
+	}
+
+	auto it = bot.nearby.find(packet.attacker_id());
+	if (it != bot.nearby.end())
+	{
+		it->second.x = packet.attacker_pos().x();
+		it->second.z = packet.attacker_pos().z();
+	}
+}
+
+void GameBotClient::HandleDamageNotify(GameBot& bot, const game::GC_DAMAGE_NOTIFY& packet)
+{
+	if (packet.target_id() != bot.playerId)
+	{
+		auto it = bot.nearby.find(packet.target_id());
+		if (it != bot.nearby.end())
+		{
+			it->second.dead = (packet.target_hp() <= 0);
+		}
+		return;
+	}
+
+	if (0 < packet.target_hp() || bot.dead)
+	{
+		return;
+	}
+
+	bot.dead = true;
+	deaths_.fetch_add(1, std::memory_order_relaxed);
+
+	// 부활 기능이 없으므로 재접속하여 새 Player로 부하 유지
+	if (config_.reconnectOnDeath && bot.user)
+	{
+		bot.user->Disconnect();
+	}
+}
+
+void GameBotClient::HandlePositionSync(GameBot& bot, const game::GC_POSITION_SYNC_NOTIFY& packet)
+{
+	bot.x = bot.destX = packet.position().x();
+	bot.z = bot.destZ = packet.position().z();
+	bot.lastPositionUpdate = Clock::now();
+}
+
+void GameBotClient::HandleError(GameBot& bot, const game::GC_ERROR_NOTIFY& packet)
+{
+	LOG_WARN("[GameBot][Player %d] Server error %d: %s", bot.playerId, packet.error_code(), packet.error_message().c_str());
+}
+
+//------------------------------
+// 행동 타이머 - 봇 행동 생성
+//------------------------------
+std::optional<GameBotClient::Clock::time_point> GameBotClient::OnActionTimer(int slot, uint32_t generation)
+{
+	GameBot& bot = bots_[slot];
+	std::lock_guard<std::recursive_mutex> lock(bot.lock);
+
+	// 퇴장/재접속으로 바뀐 입장의 타이머 -> 폐기 (다음 입장 시 새 타이머 등록)
+	if (bot.state != BotState::IN_GAME || bot.actionGeneration != generation)
+	{
+		return std::nullopt;
+	}
+
+	ProcessBotAction(bot, Clock::now());
+	return bot.nextActionTime;
+}
+
+void GameBotClient::UpdateBotPosition(GameBot& bot, Clock::time_point now)
+{
+	// 서버 MoveComponent와 같은 속도로 목적지를 향해 직선 이동
+	const float elapsed = std::chrono::duration<float>(now - bot.lastPositionUpdate).count();
+	bot.lastPositionUpdate = now;
+
+	const float dx = bot.destX - bot.x;
+	const float dz = bot.destZ - bot.z;
+	const float distance = std::sqrt(dx * dx + dz * dz);
+	const float step = BOT_MOVE_SPEED * elapsed;
+	if (distance <= step)
+	{
+		bot.x = bot.destX;
+		bot.z = bot.destZ;
+		return;
+	}
+
+	bot.x += dx / distance * step;
+	bot.z += dz / distance * step;
+}
+
+void GameBotClient::ChooseDestination(GameBot& bot, float& outX, float& outZ)
+{
+	switch (config_.pattern)
+	{
+	case CrowdPattern::UNIFORM:
+	{
+		std::uniform_real_distribution<float> dist(BOT_MAP_MIN + MAP_EDGE_MARGIN, BOT_MAP_MAX - MAP_EDGE_MARGIN);
+		outX = dist(bot.rng);
+		outZ = dist(bot.rng);
+		break;
+	}
+	case CrowdPattern::CLUSTER:
+	{
+		// 셀 안쪽에 머무르도록 가장자리 여유를 둠 (히스테리시스 0.5 보다 크게)
+		const float half = BOT_CELL_LEN * 0.5f - MAP_EDGE_MARGIN;
+		std::uniform_real_distribution<float> dist(-half, half);
+		outX = ClampToMap(config_.clusterX + dist(bot.rng));
+		outZ = ClampToMap(config_.clusterZ + dist(bot.rng));
+		break;
+	}
+	case CrowdPattern::BORDER:
+	{
+		// 현재 위치에서 셀 한 칸 전진, 맵 끝에서 방향 전환
+		float nextX = bot.x + bot.marchDir * BOT_CELL_LEN;
+		if (nextX < BOT_MAP_MIN + MAP_EDGE_MARGIN || BOT_MAP_MAX - MAP_EDGE_MARGIN < nextX)
+		{
+			bot.marchDir = -bot.marchDir;
+			nextX = bot.x + bot.marchDir * BOT_CELL_LEN;
+		}
+		outX = ClampToMap(nextX);
+		outZ = bot.z;
+		break;
+	}
+	}
+}
+
+int32_t GameBotClient::FindAttackTarget(GameBot& bot)
+{
+	// 알려진 위치는 지연되어 있으므로 서버 사거리보다 좁게 판정
+	constexpr float rangeSq = (BOT_ATTACK_RANGE * 0.9f) * (BOT_ATTACK_RANGE * 0.9f);
+
+	std::vector<int32_t> candidates;
+	for (const auto& [playerId, other] : bot.nearby)
+	{
+		const float dx = other.x - bot.x;
+		const float dz = other.z - bot.z;
+		if (!other.dead && dx * dx + dz * dz <= rangeSq)
+		{
+			candidates.push_back(playerId);
+		}
+	}
+
+	if (candidates.empty())
+	{
+		return 0;
+	}
+
+	std::uniform_int_distribution<size_t> pick(0, candidates.size() - 1);
+	return candidates[pick(bot.rng)];
+}
+
+void GameBotClient::ProcessBotAction(GameBot& bot, Clock::time_point now)
+{
+	// bot.lock 보유 상태에서 호출
+	UpdateBotPosition(bot, now);
+
+	// 다음 행동 예약 (+-20% 지터로 봇 간 동기화 방지)
+	std::uniform_int_distribution<> jitter(config_.actionIntervalMs * 8 / 10, config_.actionIntervalMs * 12 / 10);
+	bot.nextActionTime = now + std::chrono::milliseconds((std::max)(1, jitter(bot.rng)));
+
+	// 응답이 오지 않는 요청 정리
+	const int64_t nowUs = NowMicros();
+	if (bot.attackSentUs != 0 && PENDING_TIMEOUT_US < nowUs - bot.attackSentUs)
+	{
+		bot.attackSentUs = 0;
+		attackRejected_.fetch_add(1, std::memory_order_relaxed);
+	}
+	if (bot.moveSentUs != 0 && PENDING_TIMEOUT_US < nowUs - bot.moveSentUs)
+	{
+		bot.moveSentUs = 0;
+	}
+
+	// 공격: 사거리 내 대상이 있을 때 확률적으로 (공격 중에는 정지)
+	std::uniform_int_distribution<> roll(1, 1000);
+	if (!bot.dead && bot.attackSentUs == 0 && roll(bot.rng) <= config_.attackPerThousand)
+	{
+		if (const int32_t targetId = FindAttackTarget(bot))
+		{
+			bot.destX = bot.x;
+			bot.destZ = bot.z;
+
+			game::CG_ATTACK_REQ request;
+			SetPos(request.mutable_cur_pos(), bot.x, bot.z);
+			request.set_target_id(targetId);
+
+			bot.attackSentUs = nowUs;
+			if (SendBotPacket(bot, request))
+			{
+				attackSent_.fetch_add(1, std::memory_order_relaxed);
+			}
+			return;
+		}
+	}
+
+	float destX = 0.0f;
+	float destZ = 0.0f;
+	ChooseDestination(bot, destX, destZ);
+
+	game::CG_MOVE_REQ request;
+	SetPos(request.mutable_cur_pos(), bot.x, bot.z);
+	SetPos(request.mutable_move_pos(), destX, destZ);
+
+	bot.destX = destX;
+	bot.destZ = destZ;
+	if (bot.moveSentUs == 0)
+	{
+		bot.moveSentUs = nowUs;
+	}
+	if (SendBotPacket(bot, request))
+	{
+		moveSent_.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+//------------------------------
+// Monitor - 지연/대역폭 보고
+//------------------------------
+void GameBotClient::MonitorThreadFunc()
+{
+	LatencyHistogram* histograms[] = { &loginLatency_, &enterLatency_, &moveLatency_, &attackLatency_ };
+	const char* histogramNames[] = { "login ", "enter ", "move  ", "attack" };
+	constexpr int HISTOGRAM_COUNT = 4;
+
+	LatencyHistogram::Snapshot totals[HISTOGRAM_COUNT];
+	uint64_t lastRecvByType[RECV_TYPE_COUNT] = {};
+	uint64_t lastMoveSent = 0;
+	uint64_t lastAttackSent = 0;
+	uint64_t totalRecvBytes = 0;
+	uint64_t totalSentBytes = 0;
+	auto lastTime = Clock::now();
+	const auto startTime = lastTime;
+
+	while (running_.load())
+	{
+		for (int i = 0; i < MONITOR_INTERVAL_SECONDS && running_.load(); i++)
+		{
+			std::this_thread::sleep_for(std::chrono::seconds(1));
+		}
+		if (!running_.load()) break;
+
+		const auto now = Clock::now();
+		const double seconds = std::chrono::duration<double>(now - lastTime).count();
+		lastTime = now;
+
+		// 봇별 송수신량 수거 (게임 중인 봇 기준 평균/최대)
+		uint64_t recvSum = 0, sentSum = 0, packetSum = 0, recvMax = 0;
+		int activeBots = 0;
+		for (int slot = 0; slot < config_.botCount; slot++)
+		{
+			GameBot& bot = bots_[slot];
+			std::lock_guard<std::recursive_mutex> lock(bot.lock);
+			if (bot.state == BotState::IN_GAME)
+			{
+				activeBots++;
+				recvMax = (std::max)(recvMax, bot.recvBytes);
+			}
+			recvSum += bot.recvBytes;
+			sentSum += bot.sentBytes;
+			packetSum += bot.recvPackets;
+			bot.recvBytes = bot.sentBytes = bot.recvPackets = 0;
+		}
+		totalRecvBytes += recvSum;
+		totalSentBytes += sentSum;
+		const double perBot = (std::max)(1, activeBots) * seconds;
+
+		double recvRates[RECV_TYPE_COUNT];
+		for (int i = 0; i < RECV_TYPE_COUNT; i++)
+		{
+			const uint64_t count = recvByType_[i].load();
+			recvRates[i] = (count - lastRecvByType[i]) / seconds;
+			lastRecvByType[i] = count;
+		}
+
+		const uint64_t moveSent = moveSent_.load();
+		const uint64_t attackSent = attackSent_.load();
+
+		system("cls");
+		printf("=== Game Bot Swarm ===\n"
+		       "Bots: %d, pattern %s, action %dms, attack %d/1000, server %s:%d\n"
+		       "Connected: %d, in game: %d (%d in-flight, %d scheduled)\n"
+		       "Send: move %.0f/s, attack %.0f/s | attack rejected %llu, deaths %llu (total)\n"
+		       "=== Server latency (us, last %ds) ===\n",
+		       config_.botCount, GameBotConfig::PatternName(config_.pattern), config_.actionIntervalMs, config_.attackPerThousand,
+		       config_.serverIP.c_str(), config_.serverPort,
+		       connectedCount_.load(), inGameCount_.load(), GetInFlightConnectCount(), GetScheduledConnectCount(),
+		       (moveSent - lastMoveSent) / seconds, (attackSent - lastAttackSent) / seconds,
+		       attackRejected_.load(), deaths_.load(), MONITOR_INTERVAL_SECONDS);
+
+		for (int i = 0; i < HISTOGRAM_COUNT; i++)
+		{
+			const LatencyHistogram::Snapshot snapshot = histograms[i]->TakeSnapshot();
+			totals[i].Merge(snapshot);
+			printf("%s : p50 %7llu, p99 %7llu, p99.9 %7llu, max %7llu (%llu samples)\n", histogramNames[i],
+				snapshot.ValueAtPercentile(50.0), snapshot.ValueAtPercentile(99.0), snapshot.ValueAtPercentile(99.9), snapshot.max, snapshot.count);
+		}
+
+		printf("=== Per bot (in game) ===\n"
+		       "Recv: avg %.2f KB/s (%.1f pkt/s), max %.2f KB/s | Send: avg %.3f KB/s\n"
+		       "Recv/s: move %.0f, stop %.0f, appear %.0f, disappear %.0f, attack %.0f, damage %.0f, sync %.0f, error %.0f\n"
+		       "======================",
+		       recvSum / perBot / 1024.0, packetSum / perBot, recvMax / seconds / 1024.0, sentSum / perBot / 1024.0,
+		       recvRates[RECV_MOVE], recvRates[RECV_MOVE_STOP], recvRates[RECV_APPEAR], recvRates[RECV_DISAPPEAR],
+		       recvRates[RECV_ATTACK], recvRates[RECV_DAMAGE], recvRates[RECV_POSITION_SYNC], recvRates[RECV_ERROR]);
+
+		lastMoveSent = moveSent;
+		lastAttackSent = attackSent;
+	}
+
+	// 전체 구간 요약
+	const double elapsed = std::chrono::duration<double>(Clock::now() - startTime).count();
+	printf("\n=== Game Bot Swarm Summary (%.0f s, pattern %s) ===\n", elapsed, GameBotConfig::PatternName(config_.pattern));
+	for (int i = 0; i < HISTOGRAM_COUNT; i++)
+	{
+		printf("%s : p50 %7llu, p99 %7llu, p99.9 %7llu, max %7llu (%llu samples)\n", histogramNames[i],
+			totals[i].ValueAtPercentile(50.0), totals[i].ValueAtPercentile(99.0), totals[i].ValueAtPercentile(99.9), totals[i].max, totals[i].count);
+	}
+	printf("Total recv %.2f MB, sent %.2f MB\n", totalRecvBytes / (1024.0 * 1024.0), totalSentBytes / (1024.0 * 1024.0));
+}
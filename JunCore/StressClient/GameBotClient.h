@@ -0,0 +1,256 @@
+﻿#pragma once
+#include "../JunCore/network/Client.h"
+#include "../JunCore/protocol/UnifiedPacketHeader.h"
+#include "../JunCommon/timer/LatencyHistogram.h"
+#include "../GameServer/protocol/game_messages.pb.h"
+#include <vector>
+#include <thread>
+#include <random>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+
+// 게임 서버 맵/전투 설정 (GameServer.cpp, Player.h와 동일하게 유지)
+constexpr float BOT_MAP_MIN				= -40.0f;
+constexpr float BOT_MAP_MAX				=  40.0f;
+constexpr float BOT_CELL_LEN			=  10.0f;
+constexpr float BOT_MOVE_SPEED			=   5.0f;	// 초당 이동 거리 (50Hz x 0.1)
+constexpr float BOT_ATTACK_RANGE		=   7.0f;
+
+// 기본 설정값 (main에서 명령행 인자로 덮어쓸 수 있음)
+constexpr int BOT_COUNT					= 500;
+constexpr int BOT_ACTION_INTERVAL_MS	= 500;	// 봇당 행동(이동/공격) 간격
+constexpr int BOT_ATTACK_PER_THOUSAND	= 300;	// 행동 1회당 공격 시도 확률 (사거리 내 대상이 있을 때)
+constexpr int BOT_DRIVER_THREAD_COUNT	= 4;
+constexpr int BOT_CONNECT_RAMP_PER_SECOND	= 200;
+constexpr WORD GAME_SERVER_PORT			= 8888;
+
+//------------------------------
+// 봇 밀집 패턴
+//------------------------------
+enum class CrowdPattern
+{
+	UNIFORM,	// 맵 전체에 고르게 분산 (무작위 목적지)
+	CLUSTER,	// 모든 봇이 AOI 셀 하나에 밀집 (브로드캐스트 최악 케이스)
+	BORDER,		// X축으로 셀 한 칸씩 왕복 행군 (매 이동마다 셀 경계 통과 -> appear/disappear 폭주)
+};
+
+//------------------------------
+// GameBotConfig - 봇 부하 설정
+//------------------------------
+struct GameBotConfig
+{
+	int botCount				= BOT_COUNT;
+	int actionIntervalMs		= BOT_ACTION_INTERVAL_MS;
+	int attackPerThousand		= BOT_ATTACK_PER_THOUSAND;
+	int driverThreadCount		= BOT_DRIVER_THREAD_COUNT;
+	int connectsPerSecond		= BOT_CONNECT_RAMP_PER_SECOND;
+	CrowdPattern pattern		= CrowdPattern::UNIFORM;
+	float clusterX				= BOT_CELL_LEN * 0.5f;	// CLUSTER 패턴 밀집 셀 중심
+	float clusterZ				= BOT_CELL_LEN * 0.5f;
+	bool reconnectOnDeath		= true;	// HP 0이 되면 재접속 (새 Player로 부하 유지)
+	std::string serverIP		= "127.0.0.1";
+	WORD serverPort				= GAME_SERVER_PORT;
+
+	static bool ParsePattern(const char* name, CrowdPattern& out);
+	static const char* PatternName(CrowdPattern pattern);
+};
+
+//------------------------------
+// GameBotClient - 게임 프로토콜 봇 부하 발생기
+// 로그인 -> CG_SCENE_READY_REQ -> CG_MOVE_REQ / CG_ATTACK_REQ 흐름을 N개 봇으로 재현하고
+// 서버 응답 지연(요청 -> 본인 알림)과 봇당 송수신 바이트를 측정
+//------------------------------
+class GameBotClient : public Client
+{
+public:
+	GameBotClient(std::shared_ptr<IOCPManager> manager, const GameBotConfig& config = GameBotConfig{});
+	~GameBotClient();
+
+	void StopBots();
+	bool IsRunning() const { return running_.load(); }
+
+protected:
+	void OnClientStart() override;
+	void OnClientStop() override;
+	void OnUserDisconnect(User* user) override;
+	void OnConnectComplete(User* user, bool success) override;
+	void RegisterPacketHandlers() override;
+
+private:
+	using Clock = ClientTimerDriver::Clock;
+
+	enum class BotState { IDLE, LOGIN_SENT, SCENE_READY_SENT, IN_GAME };
+
+	// 시야 내 다른 플레이어 (마지막으로 알려진 위치)
+	struct KnownPlayer
+	{
+		float x = 0.0f;
+		float z = 0.0f;
+		bool dead = false;
+	};
+
+	// 봇 1개 상태, 패킷 핸들러(IOCP Worker)와 타이머 스레드가 공유하므로 lock 안에서만 접근
+	// SendPacket 실패로 같은 스레드에서 OnUserDisconnect가 재진입할 수 있어 recursive
+	struct GameBot
+	{
+		std::recursive_mutex lock;
+		int slot = 0;
+		User* user = nullptr;
+		BotState state = BotState::IDLE;
+		int32_t playerId = 0;
+		bool dead = false;
+
+		// 클라 측 위치 추정 (서버 보정 임계값 2m 이내 유지 목적)
+		float x = 0.0f;
+		float z = 0.0f;
+		float destX = 0.0f;
+		float destZ = 0.0f;
+		Clock::time_point lastPositionUpdate;
+		float marchDir = 1.0f;	// BORDER 패턴 진행 방향
+
+		Clock::time_point nextActionTime;
+		uint32_t actionGeneration = 0;	// 입장마다 증가 (이전 입장의 행동 타이머 무시용)
+		std::unordered_map<int32_t, KnownPlayer> nearby;
+
+		// 응답 대기 중인 요청 송신 시각 (0 = 대기 없음)
+		int64_t loginSentUs = 0;
+		int64_t sceneReadySentUs = 0;
+		int64_t moveSentUs = 0;
+		int64_t attackSentUs = 0;
+
+		// 현재 측정 구간 송수신량 (Monitor가 수거)
+		uint64_t recvBytes = 0;
+		uint64_t sentBytes = 0;
+		uint64_t recvPackets = 0;
+
+		std::mt19937 rng{ std::random_device{}() };
+	};
+
+	// 수신 패킷 종류별 누적 (브로드캐스트 비용 분석용)
+	enum RecvType
+	{
+		RECV_MOVE, RECV_MOVE_STOP, RECV_APPEAR, RECV_DISAPPEAR, RECV_ATTACK, RECV_DAMAGE, RECV_POSITION_SYNC, RECV_ERROR,
+		RECV_TYPE_COUNT
+	};
+
+	// 봇 패킷 핸들러 공통 처리 (슬롯 조회 + lock + 수신량 집계)
+	template<typename T>
+	void RegisterBotHandler(RecvType type, void (GameBotClient::*handler)(GameBot&, const T&));
+	template<typename T>
+	void RegisterBotHandler(void (GameBotClient::*handler)(GameBot&, const T&));
+
+	void HandleLoginRes(GameBot& bot, const game::GC_LOGIN_RES& packet);
+	void HandleSceneEnter(GameBot& bot, const game::GC_SCENE_ENTER_NOTIFY& packet);
+	void HandleMoveNotify(GameBot& bot, const game::GC_MOVE_NOTIFY& packet);
+	void HandleMoveStopNotify(GameBot& bot, const game::GC_MOVE_STOP_NOTIFY& packet);
+	void HandleAppearNotify(GameBot& bot, const game::GC_PLAYER_APPEAR_NOTIFY& packet);
+	void HandleDisappearNotify(GameBot& bot, const game::GC_PLAYER_DISAPPEAR_NOTIFY& packet);
+	void HandleAttackNotify(GameBot& bot, const game::GC_ATTACK_NOTIFY& packet);
+	void HandleDamageNotify(GameBot& bot, const game::GC_DAMAGE_NOTIFY& packet);
+	void HandlePositionSync(GameBot& bot, const game::GC_POSITION_SYNC_NOTIFY& packet);
+	void HandleError(GameBot& bot, const game::GC_ERROR_NOTIFY& packet);
+
+	template<typename T>
+	bool SendBotPacket(GameBot& bot, const T& packet);
+
+	void ResetBot(GameBot& bot);
+	std::optional<Clock::time_point> OnActionTimer(int slot, uint32_t generation);	// 다음 행동 시각 반환
+	void ProcessBotAction(GameBot& bot, Clock::time_point now);
+	void UpdateBotPosition(GameBot& bot, Clock::time_point now);
+	void ChooseDestination(GameBot& bot, float& outX, float& outZ);
+	int32_t FindAttackTarget(GameBot& bot);
+	void MonitorThreadFunc();
+	int FindSlot(User* user);
+
+	static int64_t NowMicros() { return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now().time_since_epoch()).count(); }
+
+private:
+	GameBotConfig config_;
+	std::unique_ptr<GameBot[]> bots_;
+	std::thread monitorThread_;
+	std::atomic<bool> running_{false};
+
+	// User -> 슬롯
+	std::shared_mutex slotLock_;
+	std::unordered_map<User*, int> userSlots_;
+	std::vector<int> freeSlots_;
+
+	// 서버 응답 지연 (us)
+	LatencyHistogram loginLatency_;		// CG_LOGIN_REQ -> GC_LOGIN_RES
+	LatencyHistogram enterLatency_;		// CG_SCENE_READY_REQ -> GC_SCENE_ENTER_NOTIFY
+	LatencyHistogram moveLatency_;		// CG_MOVE_REQ -> 본인 GC_MOVE_NOTIFY
+	LatencyHistogram attackLatency_;	// CG_ATTACK_REQ -> 본인 GC_ATTACK_NOTIFY
+
+	// 통계
+	std::atomic<int> connectedCount_{0};
+	std::atomic<int> inGameCount_{0};
+	std::atomic<uint64_t> moveSent_{0};
+	std::atomic<uint64_t> attackSent_{0};
+	std::atomic<uint64_t> attackRejected_{0};
+	std::atomic<uint64_t> deaths_{0};
+	std::atomic<uint64_t> recvByType_[RECV_TYPE_COUNT] = {};
+};
+
+template<typename T>
+void GameBotClient::RegisterBotHandler(void (GameBotClient::*handler)(GameBot&, const T&))
+{
+	RegisterBotHandler<T>(RECV_TYPE_COUNT, handler);
+}
+
+template<typename T>
+void GameBotClient::RegisterBotHandler(RecvType type, void (GameBotClient::*handler)(GameBot&, const T&))
+{
+	RegisterPacketHandler<T>([this, type, handler](User& user, const T& packet)
+	{
+		const int slot = FindSlot(&user);
+		if (slot < 0)
+		{
+			return;
+		}
+
+		if (type != RECV_TYPE_COUNT)
+		{
+			recvByType_[type].fetch_add(1, std::memory_order_relaxed);
+		}
+
+		GameBot& bot = bots_[slot];
+		std::lock_guard<std::recursive_mutex> lock(bot.lock);
+		if (bot.user != &user)
+		{
+			return;
+		}
+
+		bot.recvBytes += UNIFIED_HEADER_SIZE + packet.ByteSizeLong();
+		bot.recvPackets++;
+		(this->*handler)(bot, packet);
+	});
+}
+
+template<typename T>
+bool GameBotClient::SendBotPacket(GameBot& bot, const T& packet)
+{
+	// bot.lock 보유 상태에서 호출
+	if (bot.user == nullptr)
+	{
+		return false;
+	}
+
+	User* user = bot.user;
+	if (!user->SendPacket(packet))
+	{
+		if (bot.user == user)
+		{
+			user->Disconnect();
+		}
+		return false;
+	}
+
+	bot.sentBytes += UNIFIED_HEADER_SIZE + packet.ByteSizeLong();
+	return true;
+}
@@ -2,16 +2,17 @@
 #include "StressClient.h"
 #include <iostream>
 #include <chrono>
+#include <algorithm>
+#include <cstdio>
 
-thread_local std::random_device StressClient::rd;
-thread_local std::mt19937 StressClient::gen(rd());
-thread_local std::uniform_int_distribution<> StressClient::sizeDist(MESSAGE_MIN_SIZE, MESSAGE_MAX_SIZE);
-thread_local std::uniform_int_distribution<> StressClient::charDist('A', 'Z');
-
-StressClient::StressClient(std::shared_ptr<IOCPManager> manager)
-    : Client(manager, SERVER_IP.c_str(), SERVER_PORT, SESSION_COUNT)  // SESSION_COUNT개 자동 연결
+StressClient::StressClient(std::shared_ptr<IOCPManager> manager, const StressConfig& config)
+    : Client(manager, config.serverIP.c_str(), config.serverPort, config.sessionCount)  // sessionCount개 자동 연결
+    , config_(config)
 {
-    session_data_vec.reserve(SESSION_COUNT);
+    ConnectRampConfig ramp;
+    ramp.connectsPerSecond   = config_.connectsPerSecond;
+    ramp.maxInFlightConnects = config_.maxInFlightConnects;
+    SetConnectRamp(ramp);
 }
 
 StressClient::~StressClient()
@@ -35,18 +36,25 @@ void StressClient::OnClientStart()
 		return;
 	}
 
-	LOG_INFO("[StressTest] Starting stress test with %d sessions...", SESSION_COUNT);
-
-	session_data_vec.resize(SESSION_COUNT);
-	workerThreads.reserve(SESSION_COUNT);
+	LOG_INFO("[StressTest] Starting stress test with %d sessions on %d driver threads...", config_.sessionCount, config_.driverThreadCount);
 
-	// 워커 스레드 시작 (비동기 연결 대기)
-	for (int i = 0; i < SESSION_COUNT; i++)
+	sessions_ = std::make_unique<SessionData[]>(config_.sessionCount);
 	{
-		workerThreads.emplace_back(&StressClient::SessionWorker, this, i);
+		std::unique_lock<std::shared_mutex> lock(slotLock_);
+		userSlots_.clear();
+		freeSlots_.clear();
+		freeSlots_.reserve(config_.sessionCount);
+		for (int i = config_.sessionCount - 1; i >= 0; --i)
+		{
+			freeSlots_.push_back(i);
+		}
 	}
 
-	LOG_INFO("[StressTest] All %d worker threads started!", SESSION_COUNT);
+	// 타이머 드라이버 시작 (송신 타이머는 연결 완료 시 등록)
+	StartTimerDriver(config_.driverThreadCount, [this](int slot, uint32_t generation, Clock::time_point dueTime)
+	{
+		return OnSendTimer(slot, generation, dueTime);
+	});
 
 	// 모니터링 스레드 시작
 	monitorThread_ = std::thread(&StressClient::MonitorThreadFunc, this);
@@ -76,151 +84,282 @@ void StressClient::StopStressTest()
         monitorThread_.join();
     }
 
-    // 모든 워커 스레드 종료 대기
-    for (auto& t : workerThreads)
-    {
-        if (t.joinable())
-        {
-            t.join();
-        }
-    }
-    
-    // 리소스 정리
-    for (auto& sessionData : session_data_vec)
+    // 타이머 스레드 종료 대기
+    StopTimerDriver();
+
+    // 연결 정리 (User 해제는 OnUserDisconnect에서)
+    for (int slot = 0; slot < config_.sessionCount; slot++)
     {
-        auto user = sessionData.user.load();
-        if (user != nullptr && user != CLEANING)
+        std::lock_guard<std::recursive_mutex> lock(sessions_[slot].lock);
+        if (User* user = sessions_[slot].user)
         {
-			user->Disconnect();
+            sessions_[slot].disconnectRequested = true;
+            user->Disconnect();
         }
     }
-    
-    workerThreads.clear();
-    session_data_vec.clear();
+
     LOG_INFO("[StressTest] Stress test stopped.");
 }
 
 void StressClient::HandleEchoResponse(User& user, const echo::EchoResponse& response)
 {
-	SessionData* sessionData = FindSessionData(&user);
-	LOG_ASSERT_RETURN_VOID(sessionData, "[StressTest] Cannot find session data for 0x%llX", (uintptr_t)&user);
+	const int slot = FindSlot(&user);
+	LOG_ASSERT_RETURN_VOID(0 <= slot, "[StressTest] Cannot find session slot for 0x%llX", (uintptr_t)&user);
+
+	SessionData& sessionData = sessions_[slot];
+	totalReceived_.fetch_add(1, std::memory_order_relaxed);
+
+	// 송신 시각이 없는 응답(구버전 서버)은 RTT 집계에서 제외
+	if (0 < response.timestamp())
+	{
+		const int64_t rtt = NowMicros() - response.timestamp();
+		rttHistogram_.Record(static_cast<uint64_t>((std::max)(int64_t{0}, rtt)));
+	}
 
 	// sentMessages에서 메시지 dequeue 시도
 	std::string expectedMessage;
-	if (!sessionData->sentMessages.Dequeue(&expectedMessage))
+	if (!sessionData.sentMessages.Dequeue(&expectedMessage))
 	{
-		LOG_ASSERT("[StressTest][Session %d] Received response but no sent messages!", sessionData->sessionIndex);
+		mismatchCount_.fetch_add(1, std::memory_order_relaxed);
+		LOG_ASSERT("[StressTest][Session %d] Received response but no sent messages!", slot);
 		return;
 	}
 
-	std::string responseMessage = response.message();
-	
 	// Echo 받은 메시지가 내가 보낸 메시지와 다르면 에러
-	LOG_ASSERT_RETURN_VOID(expectedMessage == responseMessage,
-						   "[StressTest][Session %d] Message mismatch! Expected: '%s', Got: '%s'",
-						   sessionData->sessionIndex, expectedMessage.c_str(), responseMessage.c_str());
+	if (expectedMessage != response.message())
+	{
+		mismatchCount_.fetch_add(1, std::memory_order_relaxed);
+		LOG_ASSERT("[StressTest][Session %d] Message mismatch! Expected: '%s', Got: '%s'",
+				   slot, expectedMessage.c_str(), response.message().c_str());
+	}
+}
+
+namespace
+{
+	// 초당 통계 기록 (--stats 경로 확장자로 CSV / JSON 배열 선택)
+	class StatsWriter
+	{
+	public:
+		explicit StatsWriter(const std::string& path)
+		{
+			if (path.empty())
+			{
+				return;
+			}
+
+			if (fopen_s(&file_, path.c_str(), "w") != 0 || file_ == nullptr)
+			{
+				LOG_ERROR("[StressTest] Failed to open stats file: %s", path.c_str());
+				file_ = nullptr;
+				return;
+			}
+
+			json_ = (path.size() >= 5 && path.compare(path.size() - 5, 5, ".json") == 0);
+			if (json_)
+			{
+				fputs("[\n", file_);
+			}
+			else
+			{
+				fputs("second,connected,send_per_sec,recv_per_sec,rtt_count,rtt_mean_us,rtt_p50_us,rtt_p99_us,rtt_p999_us,rtt_max_us,mismatches\n", file_);
+			}
+		}
+
+		~StatsWriter()
+		{
+			if (file_ == nullptr)
+			{
+				return;
+			}
+
+			if (json_)
+			{
+				fputs("\n]\n", file_);
+			}
+			fclose(file_);
+		}
+
+		void Write(int second, int connected, double sendPerSec, double recvPerSec, const LatencyHistogram::Snapshot& rtt, uint64_t mismatches)
+		{
+			if (file_ == nullptr)
+			{
+				return;
+			}
+
+			const char* format = json_
+				? "%s{\"second\":%d,\"connected\":%d,\"send_per_sec\":%.1f,\"recv_per_sec\":%.1f,\"rtt_count\":%llu,\"rtt_mean_us\":%.1f,"
+				  "\"rtt_p50_us\":%llu,\"rtt_p99_us\":%llu,\"rtt_p999_us\":%llu,\"rtt_max_us\":%llu,\"mismatches\":%llu}"
+				: "%s%d,%d,%.1f,%.1f,%llu,%.1f,%llu,%llu,%llu,%llu,%llu\n";
+
+			fprintf(file_, format, (json_ && 0 < rows_) ? ",\n" : "",
+				second, connected, sendPerSec, recvPerSec, rtt.count, rtt.Mean(),
+				rtt.ValueAtPercentile(50.0), rtt.ValueAtPercentile(99.0), rtt.ValueAtPercentile(99.9), rtt.max, mismatches);
+			fflush(file_);
+			rows_++;
+		}
+
+	private:
+		FILE* file_ = nullptr;
+		bool json_ = false;
+		int rows_ = 0;
+	};
 }
 
 void StressClient::MonitorThreadFunc()
 {
 	LOG_INFO("[StressTest] Monitor thread started");
 
+	constexpr int DISPLAY_INTERVAL_SECONDS = 5;
+
+	StatsWriter statsWriter(config_.statsOutputPath);
+	LatencyHistogram::Snapshot displayRtt;	// 화면 갱신 구간 (5초) 누적
+	LatencyHistogram::Snapshot totalRtt;	// 테스트 전체 누적
+
+	uint64_t lastSent = 0;
+	uint64_t lastReceived = 0;
+	uint64_t displaySent = 0;
+	uint64_t displayReceived = 0;
+	auto lastTime = Clock::now();
+	auto displayTime = lastTime;
+	int second = 0;
+
 	while (testRunning.load())
 	{
-		// 5초마다 설정 정보 출력
-		std::this_thread::sleep_for(std::chrono::seconds(5));
+		// 1초마다 RTT/처리량 수거, 5초마다 화면 갱신
+		std::this_thread::sleep_for(std::chrono::seconds(1));
 
 		if (!testRunning.load()) break;
 
+		const auto now = Clock::now();
+		const double seconds = std::chrono::duration<double>(now - lastTime).count();
+		const uint64_t sent = totalSent_.load();
+		const uint64_t received = totalReceived_.load();
+		const LatencyHistogram::Snapshot rtt = rttHistogram_.TakeSnapshot();
+
+		statsWriter.Write(++second, connectedCount_.load(), (sent - lastSent) / seconds, (received - lastReceived) / seconds, rtt, mismatchCount_.load());
+		displayRtt.Merge(rtt);
+		totalRtt.Merge(rtt);
+
+		lastSent = sent;
+		lastReceived = received;
+		lastTime = now;
+
+		if (second % DISPLAY_INTERVAL_SECONDS != 0)
+		{
+			continue;
+		}
+
+		const double displaySeconds = std::chrono::duration<double>(now - displayTime).count();
+
 		system("cls");
 		printf("=== Stress Test Configuration ===\n"
-		       "Session Count: %d\n"
+		       "Session Count: %d (%d driver threads)\n"
 		       "Message Interval: %dms\n"
 		       "Message Size Range: %d-%d chars\n"
 		       "Server: %s:%d\n"
+		       "Connect Ramp: %d/s (in-flight max %d)\n"
+		       "=== Status ===\n"
+		       "Connected: %d (%d in-flight, %d scheduled)\n"
+		       "Send: %.0f msg/s, Recv: %.0f msg/s\n"
+		       "RTT(us, last %ds): p50 %llu, p99 %llu, p99.9 %llu, max %llu (mean %.1f)\n"
+		       "RTT(us, total)   : p50 %llu, p99 %llu, p99.9 %llu, max %llu\n"
+		       "Total: %llu sent, %llu received, %llu mismatches\n"
 		       "=================================",
-		       SESSION_COUNT, MESSAGE_INTERVAL_MS, MESSAGE_MIN_SIZE, MESSAGE_MAX_SIZE,
-		       SERVER_IP.c_str(), SERVER_PORT);
+		       config_.sessionCount, GetTimerThreadCount(),
+		       config_.messageIntervalMs, config_.messageMinSize, config_.messageMaxSize,
+		       config_.serverIP.c_str(), config_.serverPort,
+		       config_.connectsPerSecond, config_.maxInFlightConnects,
+		       connectedCount_.load(), GetInFlightConnectCount(), GetScheduledConnectCount(),
+		       (sent - displaySent) / displaySeconds, (received - displayReceived) / displaySeconds,
+		       DISPLAY_INTERVAL_SECONDS,
+		       displayRtt.ValueAtPercentile(50.0), displayRtt.ValueAtPercentile(99.0), displayRtt.ValueAtPercentile(99.9), displayRtt.max, displayRtt.Mean(),
+		       totalRtt.ValueAtPercentile(50.0), totalRtt.ValueAtPercentile(99.0), totalRtt.ValueAtPercentile(99.9), totalRtt.max,
+		       sent, received, mismatchCount_.load());
+
+		displayRtt = LatencyHistogram::Snapshot{};
+		displaySent = sent;
+		displayReceived = received;
+		displayTime = now;
 	}
 
-	LOG_INFO("[StressTest] Monitor thread stopped");
+	LOG_INFO("[StressTest] Monitor thread stopped (RTT total: %llu samples, p99 %llu us, max %llu us)",
+		totalRtt.count, totalRtt.ValueAtPercentile(99.0), totalRtt.max);
 }
 
-void StressClient::SessionWorker(int sessionIndex)
+std::optional<StressClient::Clock::time_point> StressClient::OnSendTimer(int slot, uint32_t generation, Clock::time_point dueTime)
 {
-    LOG_ASSERT_RETURN_VOID(sessionIndex < SESSION_COUNT, "[StressTest] Invalid session index: %d", sessionIndex);
-
-	session_data_vec[sessionIndex] = std::move(SessionData(nullptr, sessionIndex));
-	SessionData& sessionData = session_data_vec[sessionIndex];
-
-	LOG_INFO("[StressTest][Session %d] Worker thread started, waiting for connection...", sessionIndex);
-
-	while (testRunning.load())
 	{
-		auto user = sessionData.user.load();
-
-		// nullptr 또는 CLEANING이면 대기
-		if (user == nullptr || user == CLEANING)
+		std::lock_guard<std::recursive_mutex> lock(sessions_[slot].lock);
+		if (!ProcessSendTimer(slot, generation))
 		{
-			std::this_thread::sleep_for(std::chrono::milliseconds(100));
-			continue;
+			return std::nullopt;
 		}
+	}
 
-		// 정리 대기 중인 세션이라면,
-		if (sessionData.disconnectRequested.load())
-		{
-			// 정리 대기
-			std::this_thread::sleep_for(std::chrono::milliseconds(10));
-			continue;
-		}
+	// 예정 시각 기준으로 다음 송신 예약, 밀린 경우 몰아서 보내지 않도록 현재 시각으로 보정
+	auto nextDue = dueTime + std::chrono::milliseconds(config_.messageIntervalMs);
+	const auto now = Clock::now();
+	if (nextDue < now)
+	{
+		nextDue = now;
+	}
+	return nextDue;
+}
 
-		// 랜덤 disconnect
-		std::uniform_int_distribution<> dist(1, 1000);
-		if (dist(sessionData.randomGenerator) <= DISCONNECT_PROBABILITY_PER_THOUSAND)
-		{
-			sessionData.disconnectRequested.store(true);
-			user->Disconnect();
-			// user 포인터는 OnDisconnect에서 무효화
-			continue;
-		}
+bool StressClient::ProcessSendTimer(int slot, uint32_t generation)
+{
+	// 슬롯 lock 보유 상태에서 호출됨
+	SessionData& sessionData = sessions_[slot];
+	User* user = sessionData.user;
 
-		std::string message = GenerateRandomMessage();
-		sessionData.sentMessages.Enqueue(message);
+	// 끊겼거나 이전 연결의 타이머 -> 폐기 (재연결 시 새 타이머 등록)
+	if (user == nullptr || sessionData.generation != generation || sessionData.disconnectRequested)
+	{
+		return false;
+	}
 
-		echo::EchoRequest request;
-		request.set_message(message);
+	// 랜덤 disconnect
+	std::uniform_int_distribution<> dist(1, 1000);
+	if (dist(sessionData.randomGenerator) <= config_.disconnectPerThousand)
+	{
+		sessionData.disconnectRequested = true;
+		user->Disconnect();
+		// user 포인터는 OnUserDisconnect에서 무효화
+		return false;
+	}
 
-		// 패킷 송신, 실패 시 어설트
-		// 실패 case 1. 서버에서 세션을 끊음 -> 스트레스 클라이언트를 끊을 이유가 없다. 서버 이슈
-		// 실패 case 2. 스트레스 클라이언트에서 Disconnect 한것 -> Disconnect 세션에 대해서는 패킷 송신하지 않는다. 클라이언트 이슈.
-		if (!user->SendPacket(request))
-		{
-			LOG_ASSERT("[StressTest][Session %d] Failed to send message after %d successful sends", sessionIndex, sessionData.totalSendCount);
-			user->Disconnect();
-			return;
-		}
+	std::string message = GenerateRandomMessage(sessionData.randomGenerator);
+	sessionData.sentMessages.Enqueue(message);
 
-		// 송신 성공 시 카운터 증가
-		sessionData.totalSendCount++;
+	echo::EchoRequest request;
+	request.set_message(message);
+	request.set_timestamp(NowMicros());
 
-		// 스트레스 테스트를 위한 최소 간격
-		if (0 < MESSAGE_INTERVAL_MS)
+	// 패킷 송신, 실패 시 어설트
+	// 실패 case 1. 서버에서 세션을 끊음 -> 스트레스 클라이언트를 끊을 이유가 없다. 서버 이슈
+	// 실패 case 2. 스트레스 클라이언트에서 Disconnect 한것 -> Disconnect 세션에 대해서는 패킷 송신하지 않는다. 클라이언트 이슈.
+	if (!user->SendPacket(request))
+	{
+		LOG_ASSERT("[StressTest][Session %d] Failed to send message after %d successful sends", slot, sessionData.totalSendCount);
+		if (sessionData.user == user)
 		{
-			std::this_thread::sleep_for(std::chrono::milliseconds(MESSAGE_INTERVAL_MS));
+			sessionData.disconnectRequested = true;
+			user->Disconnect();
 		}
+		return false;
 	}
 
-	// 정리
-	if (auto user = sessionData.user.load())
-	{
-		user->Disconnect();
-	}
-
-	LOG_INFO("[StressTest][Session %d] Worker thread ended", sessionIndex);
+	// 송신 성공 시 카운터 증가
+	sessionData.totalSendCount++;
+	totalSent_.fetch_add(1, std::memory_order_relaxed);
+	return true;
 }
 
-std::string StressClient::GenerateRandomMessage()
+std::string StressClient::GenerateRandomMessage(std::mt19937& gen) const
 {
+    std::uniform_int_distribution<> sizeDist(config_.messageMinSize, config_.messageMaxSize);
+    std::uniform_int_distribution<> charDist('A', 'Z');
+
     int length = sizeDist(gen);
     std::string message;
     message.reserve(length);
@@ -233,48 +372,58 @@ std::string StressClient::GenerateRandomMessage()
     return message;
 }
 
-SessionData* StressClient::FindSessionData(User* user)
+int StressClient::FindSlot(User* user)
 {
-    for (auto& sessionData : session_data_vec)
-    {
-        if (sessionData.user.load() == user)
-        {
-            return &sessionData;
-        }
-    }
-    return nullptr;
+    std::shared_lock<std::shared_mutex> lock(slotLock_);
+    auto it = userSlots_.find(user);
+    return (it != userSlots_.end()) ? it->second : -1;
 }
 
-
 void StressClient::OnUserDisconnect(User* user)
 {
-	SessionData* sessionData = FindSessionData(user);
-	if (sessionData)
+	int slot = -1;
 	{
-		if (sessionData->disconnectRequested.load())
+		std::unique_lock<std::shared_mutex> lock(slotLock_);
+		auto it = userSlots_.find(user);
+		if (it != userSlots_.end())
 		{
-			// 능동적 disconnect의 경우
-			LOG_INFO("[StressTest] Expected disconnect for session %d: 0x%llX", sessionData->sessionIndex, (uintptr_t)user);
+			slot = it->second;
+			userSlots_.erase(it);
 		}
-		else
+	}
+
+	if (0 <= slot)
+	{
+		// 타이머 스레드가 이 User로 송신 중이 아님을 보장한 뒤 슬롯 정리
 		{
-			// 서버에 의해 끊킨것이므로 에러
-			LOG_ASSERT("[StressTest] Unexpected server disconnect for session %d: 0x%llX", sessionData->sessionIndex, (uintptr_t)user);
-		}
+			SessionData& sessionData = sessions_[slot];
+			std::lock_guard<std::recursive_mutex> lock(sessionData.lock);
 
-		// 1. CLEANING 상태로 변경 (즉시 nullptr로 수정 시 초기화 전 OnConnectComplete에서 건들기때문)
-		sessionData->user.store(CLEANING);
+			if (sessionData.disconnectRequested)
+			{
+				// 능동적 disconnect의 경우
+				LOG_INFO("[StressTest] Expected disconnect for session %d: 0x%llX", slot, (uintptr_t)user);
+			}
+			else
+			{
+				// 서버에 의해 끊킨것이므로 에러
+				LOG_ASSERT("[StressTest] Unexpected server disconnect for session %d: 0x%llX", slot, (uintptr_t)user);
+			}
 
-		// 2. 정리 작업 (안전 - SessionWorker가 CLEANING 보고 스킵)
-		sessionData->disconnectRequested.store(false);
-		sessionData->totalSendCount = 0;
+			sessionData.user = nullptr;
+			sessionData.disconnectRequested = false;
+			sessionData.totalSendCount = 0;
 
-		// Queue 비우기
-		std::string msg;
-		while (sessionData->sentMessages.Dequeue(&msg));
+			// Queue 비우기
+			std::string msg;
+			while (sessionData.sentMessages.Dequeue(&msg));
+		}
 
-		// 3. 정리 완료
-		sessionData->user.store(nullptr);
+		connectedCount_.fetch_sub(1);
+		{
+			std::unique_lock<std::shared_mutex> lock(slotLock_);
+			freeSlots_.push_back(slot);
+		}
 	}
 	else
 	{
@@ -288,33 +437,43 @@ void StressClient::OnUserDisconnect(User* user)
 
 void StressClient::OnConnectComplete(User* user, bool success)
 {
-	if (success)
+	if (!success)
 	{
-		// 슬롯 찾을 때까지 무한 재시도
-		while (true)
-		{
-			for (int i = 0; i < SESSION_COUNT; i++)
-			{
-				// 원자적으로 nullptr을 user로 교체 (CAS 필수 - 동시 연결 경쟁 방지)
-				User* expected = nullptr;
-				if (session_data_vec[i].user.compare_exchange_strong(expected, user))
-				{
-					// 성공! 슬롯 획득 (초기화는 OnUserDisconnect에서 이미 완료됨)
-					LOG_INFO("[StressTest][Session %d] Connected! User: 0x%llX", i, (uintptr_t)user);
-					return;
-				}
-				// compare_exchange 실패 시 다음 슬롯 시도 (nullptr 아니거나 다른 스레드가 먼저 획득)
-			}
+		LOG_ERROR("[StressTest] Failed to connect to server");
+		return;
+	}
 
-			// 한 바퀴 돌았는데 슬롯 없음 → 정리 중인 슬롯 기다리기
-			LOG_DEBUG("[StressTest] All slots busy or cleaning, waiting 10ms...");
-			std::this_thread::sleep_for(std::chrono::milliseconds(10));
-			// 다시 처음부터 재시도
+	int slot = -1;
+	{
+		std::unique_lock<std::shared_mutex> lock(slotLock_);
+		if (!freeSlots_.empty())
+		{
+			slot = freeSlots_.back();
+			freeSlots_.pop_back();
+			userSlots_[user] = slot;
 		}
 	}
-	else
+
+	if (slot < 0)
 	{
-		LOG_ERROR("[StressTest] Failed to connect to server");
+		// Client 연결 수 = 슬롯 수이므로 발생하지 않아야 함
+		LOG_ERROR("[StressTest] No free session slot for 0x%llX", (uintptr_t)user);
+		user->Disconnect();
+		return;
 	}
-}
 
+	// 슬롯 활성화 + 첫 송신 예약 (간격 내 무작위 오프셋으로 분산)
+	{
+		SessionData& sessionData = sessions_[slot];
+		std::lock_guard<std::recursive_mutex> lock(sessionData.lock);
+		sessionData.user = user;
+		sessionData.generation++;
+
+		std::uniform_int_distribution<> offsetDist(0, (std::max)(0, config_.messageIntervalMs - 1));
+		const auto dueTime = Clock::now() + std::chrono::milliseconds(offsetDist(sessionData.randomGenerator));
+		ScheduleTimer(slot, sessionData.generation, dueTime);
+	}
+
+	connectedCount_.fetch_add(1);
+	LOG_INFO("[StressTest][Session %d] Connected! User: 0x%llX", slot, (uintptr_t)user);
+}
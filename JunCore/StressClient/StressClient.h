@@ -2,38 +2,84 @@
 #include "../JunCore/network/Client.h"
 #include "../JunCore/protocol/UnifiedPacketHeader.h"
 #include "../JunCommon/container/LFQueue.h"
+#include "../JunCommon/timer/LatencyHistogram.h"
 #include "../EchoServer/echo_message.pb.h"
 #include <vector>
 #include <thread>
 #include <random>
 #include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <chrono>
+#include <memory>
+#include <optional>
 #include <cassert>
 
-constexpr int SESSION_COUNT			= 200;
-constexpr int MESSAGE_INTERVAL_MS	= 1; // 최소 1 이상 권장, 0은 SendQ 터지는 현상 발생함
+// 기본 설정값 (main에서 명령행 인자로 덮어쓸 수 있음)
+// NOTE: 1만 세션 이상은 클라 장비의 임시 포트 범위 확장 필요
+//       netsh int ipv4 set dynamicport tcp start=10000 num=55000
+constexpr int SESSION_COUNT			= 10000;
+constexpr int MESSAGE_INTERVAL_MS	= 100;	// 세션당 송신 간격
 constexpr int MESSAGE_MIN_SIZE		= 10;
 constexpr int MESSAGE_MAX_SIZE		= 100;
-constexpr int DISCONNECT_PROBABILITY_PER_THOUSAND = 1;
+constexpr int DISCONNECT_PROBABILITY_PER_THOUSAND = 1;	// 송신 1회당 능동 끊기 확률
+constexpr int DRIVER_THREAD_COUNT	= 4;	// 송신 타이머를 처리하는 스레드 수 (세션은 slot % N으로 분배)
+constexpr int CONNECT_RAMP_PER_SECOND	= 1000;	// 초당 connect 시도 수 (서버 재시작 시 accept 폭주 방지)
+constexpr int MAX_IN_FLIGHT_CONNECTS	= 200;	// 동시 진행 connect 최대 수
 const std::string SERVER_IP			= "127.0.0.1";
 constexpr WORD SERVER_PORT			= 7777;
 
-// CLEANING 상태 플래그 (세션 정리 중)
-#define CLEANING (reinterpret_cast<User*>(0x1))
+//------------------------------
+// StressConfig - 부하 설정
+//------------------------------
+struct StressConfig
+{
+	int sessionCount			= SESSION_COUNT;
+	int messageIntervalMs		= MESSAGE_INTERVAL_MS;
+	int messageMinSize			= MESSAGE_MIN_SIZE;
+	int messageMaxSize			= MESSAGE_MAX_SIZE;
+	int disconnectPerThousand	= DISCONNECT_PROBABILITY_PER_THOUSAND;
+	int driverThreadCount		= DRIVER_THREAD_COUNT;
+	int connectsPerSecond		= CONNECT_RAMP_PER_SECOND;
+	int maxInFlightConnects		= MAX_IN_FLIGHT_CONNECTS;
+	std::string serverIP		= SERVER_IP;
+	WORD serverPort				= SERVER_PORT;
+	std::string statsOutputPath;		// 초당 RTT/처리량 기록 파일 (.csv 또는 .json, 비어있으면 기록 안 함)
+};
 
-struct SessionData;
+//------------------------------
+// SessionData - 세션 슬롯별 상태
+// user / generation 변경과 송신은 lock 안에서만 수행
+// SendPacket 실패로 세션이 같은 스레드에서 해제되면 OnUserDisconnect가 재진입하므로 recursive
+//------------------------------
+struct SessionData
+{
+	std::recursive_mutex lock;
+	User* user = nullptr;
+	uint32_t generation = 0;				// 연결마다 증가 (이전 연결의 타이머 항목 무시용)
+	LFQueue<std::string> sentMessages;		// 응답 순서 검증용 (송신: 타이머 스레드, 수신: IOCP Worker)
+	std::mt19937 randomGenerator{ std::random_device{}() };
+	bool disconnectRequested = false;		// 능동 끊기 플래그
+	int totalSendCount = 0;					// 현재 연결의 누적 send 회수
+};
 
+//------------------------------
+// StressClient - 이벤트 기반 에코 부하 발생기
+// 세션별 스레드 대신 Client 타이머 드라이버(소수 스레드의 min-heap)가 송신 주기를 처리
+//------------------------------
 class StressClient : public Client
 {
 public:
-    StressClient(std::shared_ptr<IOCPManager> manager);
+    StressClient(std::shared_ptr<IOCPManager> manager, const StressConfig& config = StressConfig{});
     ~StressClient();
 
     void StopStressTest();
     bool IsRunning() const { return testRunning.load(); }
 
 protected:
-    void OnClientStart() override;  // 워커 스레드 시작
-    void OnClientStop() override;   // 워커 스레드 정리
+    void OnClientStart() override;  // 타이머 드라이버 시작
+    void OnClientStop() override;   // 타이머 드라이버 정리
     void OnUserDisconnect(User* user) override;
     void OnConnectComplete(User* user, bool success) override;
     void RegisterPacketHandlers() override;
@@ -42,67 +88,29 @@ private:
     void HandleEchoResponse(User& user, const echo::EchoResponse& response);
 
 private:
-    std::vector<SessionData> session_data_vec;
-    std::vector<std::thread> workerThreads;
+    using Clock = ClientTimerDriver::Clock;
+
+    StressConfig config_;
+    std::unique_ptr<SessionData[]> sessions_;
     std::atomic<bool> testRunning{false};
     std::thread monitorThread_;  // 상태 모니터링 스레드
-    
-    void SessionWorker(int sessionIndex);
-    void MonitorThreadFunc();  // 상태 모니터링
-    std::string GenerateRandomMessage();
-    SessionData* FindSessionData(User* user);
-    
-    thread_local static std::random_device rd;
-    thread_local static std::mt19937 gen;
-    thread_local static std::uniform_int_distribution<> sizeDist;
-    thread_local static std::uniform_int_distribution<> charDist;
-};
 
-struct SessionData
-{
-	std::atomic<User*> user{nullptr};  // 원자적 포인터 (OnConnectComplete에서 할당)
-	std::thread workerThread;
-	LFQueue<std::string> sentMessages;
-	int sessionIndex = 0;
-	std::mt19937 randomGenerator{ std::random_device{}() };
-	std::atomic<bool> disconnectRequested{false};  // 능동 끊기 플래그
-	int totalSendCount = 0;  // 누적 send 회수
+    // User -> 슬롯 (응답 처리 시 조회, 연결/끊김 시 갱신)
+    std::shared_mutex slotLock_;
+    std::unordered_map<User*, int> userSlots_;
+    std::vector<int> freeSlots_;
 
-	SessionData() = default;
-	SessionData(User* _user, int _sessionIndex)
-		: user(_user), sessionIndex(_sessionIndex)
-	{
-	}
-	// 복사 생성자와 대입 연산자 삭제 (atomic 멤버 때문)
-	SessionData(const SessionData&) = delete;
-	SessionData& operator=(const SessionData&) = delete;
-	
-	SessionData(SessionData&& other) noexcept
-		: user(other.user.load())
-		, workerThread(std::move(other.workerThread))
-		, sessionIndex(other.sessionIndex)
-		, randomGenerator(std::move(other.randomGenerator))
-		, disconnectRequested(other.disconnectRequested.load())
-		, totalSendCount(other.totalSendCount)
-	{
-		other.user.store(nullptr);
-		other.totalSendCount = 0;
-		// LFQueue는 이동 생성자가 없으므로 빈 큐로 초기화됨
-	}
+    // 통계
+    std::atomic<int> connectedCount_{0};
+    std::atomic<uint64_t> totalSent_{0};
+    std::atomic<uint64_t> totalReceived_{0};
+    std::atomic<uint64_t> mismatchCount_{0};
+    LatencyHistogram rttHistogram_;  // 에코 왕복 시간 (us), Monitor가 1초마다 수거
 
-	SessionData& operator=(SessionData&& other) noexcept
-	{
-		if (this != &other) {
-			user.store(other.user.load());
-			workerThread = std::move(other.workerThread);
-			sessionIndex = other.sessionIndex;
-			randomGenerator = std::move(other.randomGenerator);
-			disconnectRequested.store(other.disconnectRequested.load());
-			totalSendCount = other.totalSendCount;
-			other.user.store(nullptr);
-			other.totalSendCount = 0;
-			// LFQueue는 이동 대입 연산자가 없으므로 기존 큐 유지
-		}
-		return *this;
-	}
-};
\ No newline at end of file
+    std::optional<Clock::time_point> OnSendTimer(int slot, uint32_t generation, Clock::time_point dueTime);  // 다음 송신 시각 반환
+    bool ProcessSendTimer(int slot, uint32_t generation);  // 송신 성공 여부 반환
+    void MonitorThreadFunc();  // 상태 모니터링
+    static int64_t NowMicros() { return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now().time_since_epoch()).count(); }
+    std::string GenerateRandomMessage(std::mt19937& gen) const;
+    int FindSlot(User* user);
+};
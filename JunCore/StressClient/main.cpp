@@ -1,26 +1,142 @@
 ﻿#include "../JunCommon/system/CrashDump.h"
 #include "../JunCore/network/IOCPManager.h"
 #include "StressClient.h"
+#include "GameBotClient.h"
+#include "../JunCore/network/PacketReplayClient.h"
 #include "../EchoServer/echo_message.pb.h"
 #include <iostream>
 #include <string>
 #include <chrono>
 #include <iomanip>
+#include <cstring>
+#include <cstdlib>
 using namespace std;
 using namespace std::chrono;
 
 static CrashDump dump;
 
-int main() 
+// 캡처 재생 모드: StressClient --replay <file> [speed] [ip] [port]
+int RunReplay(const std::string& capturePath, double speed, const std::string& ip, WORD port)
+{
+    PacketCaptureReader::Summary summary;
+    if (!PacketCaptureReader::Summarize(capturePath, summary))
+    {
+        LOG_ERROR("Invalid capture file: %s", capturePath.c_str());
+        return -1;
+    }
+
+    printf("Capture: %u streams (max concurrent %u), %llu frames, %.2f MB, %.2f s\n",
+        summary.stream_count, summary.max_concurrent, summary.frame_count,
+        summary.byte_count / (1024.0 * 1024.0), summary.duration_us / 1000000.0);
+
+    auto iocpManager = IOCPManager::Create().WithWorkerCount(4).Build();
+    PacketReplayClient client(std::shared_ptr<IOCPManager>(std::move(iocpManager)), ip.c_str(), port, capturePath, (std::max)(1, static_cast<int>(summary.max_concurrent)));
+    client.Initialize();
+    client.StartClient();
+
+    const ReplayResult result = client.Replay(speed);
+    client.StopClient();
+
+    printf("Replay: streams=%u, sent=%llu, skipped=%llu, elapsed=%.2f s (x%.2f), max lag=%.2f ms\n",
+        result.streamsReplayed, result.framesSent, result.framesSkipped, result.elapsedSeconds,
+        (0.0 < result.elapsedSeconds) ? result.capturedSeconds / result.elapsedSeconds : 0.0, result.maxLagMs);
+    return result.completed ? 0 : -1;
+}
+
+// 게임 봇 모드: StressClient --bots N [--pattern uniform|cluster|border] [--action MS] [--attack PERMILLE]
+//                [--drivers N] [--ramp N] [--no-respawn] [--ip IP] [--port P]
+int RunBots(int argc, char* argv[])
+{
+    GameBotConfig config;
+    config.botCount = atoi(argv[2]);
+    for (int i = 3; i < argc; i++)
+    {
+        const bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--pattern") == 0 && hasValue)
+        {
+            if (!GameBotConfig::ParsePattern(argv[++i], config.pattern))
+            {
+                LOG_WARN("Unknown pattern: %s (uniform|cluster|border)", argv[i]);
+            }
+        }
+        else if (strcmp(argv[i], "--action") == 0 && hasValue)      config.actionIntervalMs = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--attack") == 0 && hasValue)      config.attackPerThousand = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--drivers") == 0 && hasValue)     config.driverThreadCount = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--ramp") == 0 && hasValue)        config.connectsPerSecond = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--ip") == 0 && hasValue)          config.serverIP = argv[++i];
+        else if (strcmp(argv[i], "--port") == 0 && hasValue)        config.serverPort = static_cast<WORD>(atoi(argv[++i]));
+        else if (strcmp(argv[i], "--no-respawn") == 0)              config.reconnectOnDeath = false;
+        else
+        {
+            LOG_WARN("Unknown argument: %s", argv[i]);
+        }
+    }
+
+    auto iocpManager = IOCPManager::Create().WithWorkerCount(4).Build();
+    GameBotClient client(std::shared_ptr<IOCPManager>(std::move(iocpManager)), config);
+    client.Initialize();
+    client.StartClient();
+
+    LOG_INFO("Game bots running. Press Enter to stop...");
+    cin.get();
+
+    client.StopClient();
+    return 0;
+}
+
+// 부하 설정: --sessions N --interval MS --size MIN MAX --disconnect PERMILLE --drivers N --ramp N --ip IP --port P --stats FILE(.csv|.json)
+StressConfig ParseStressConfig(int argc, char* argv[])
+{
+    StressConfig config;
+    for (int i = 1; i < argc; i++)
+    {
+        const bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--sessions") == 0 && hasValue)         config.sessionCount = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--interval") == 0 && hasValue)    config.messageIntervalMs = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--disconnect") == 0 && hasValue)  config.disconnectPerThousand = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--drivers") == 0 && hasValue)     config.driverThreadCount = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--ramp") == 0 && hasValue)        config.connectsPerSecond = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--ip") == 0 && hasValue)          config.serverIP = argv[++i];
+        else if (strcmp(argv[i], "--port") == 0 && hasValue)        config.serverPort = static_cast<WORD>(atoi(argv[++i]));
+        else if (strcmp(argv[i], "--stats") == 0 && hasValue)       config.statsOutputPath = argv[++i];
+        else if (strcmp(argv[i], "--size") == 0 && i + 2 < argc)
+        {
+            config.messageMinSize = atoi(argv[++i]);
+            config.messageMaxSize = atoi(argv[++i]);
+        }
+        else
+        {
+            LOG_WARN("Unknown argument: %s", argv[i]);
+        }
+    }
+    return config;
+}
+
+int main(int argc, char* argv[]) 
 {
     try
     {
+        if (argc >= 3 && strcmp(argv[1], "--replay") == 0)
+        {
+            LOGGER_INITIALIZE_SYNC(LOG_LEVEL_WARN);
+            const double speed = (argc >= 4) ? atof(argv[3]) : 1.0;
+            const std::string ip = (argc >= 5) ? argv[4] : SERVER_IP;
+            const WORD port = (argc >= 6) ? static_cast<WORD>(atoi(argv[5])) : SERVER_PORT;
+            return RunReplay(argv[2], speed, ip, port);
+        }
+
+        if (argc >= 3 && strcmp(argv[1], "--bots") == 0)
+        {
+            LOGGER_INITIALIZE_SYNC(LOG_LEVEL_WARN);
+            return RunBots(argc, argv);
+        }
+
         // Logger 초기화 (비동기 모드)
         LOGGER_INITIALIZE_SYNC(LOG_LEVEL_WARN);
         
         auto iocpManager = IOCPManager::Create().WithWorkerCount(4).Build();
 
-        StressClient client(std::shared_ptr<IOCPManager>(std::move(iocpManager)));
+        StressClient client(std::shared_ptr<IOCPManager>(std::move(iocpManager)), ParseStressConfig(argc, argv));
         client.Initialize();
 
         LOG_INFO("Starting stress test in 3 seconds...");
@@ -0,0 +1,163 @@
+﻿#include <iostream>
+#include "../JunCore/core/base.h"    // JunCore 프로젝트의 강제 포함 헤더 (Test 프로젝트에는 없음)
+#include "../JunCore/network/IngressLimit.h"
+
+using namespace std;
+
+namespace
+{
+    constexpr uint32_t MOVE_ID = 1;
+    constexpr uint32_t ATTACK_ID = 2;
+
+    bool Check(bool condition, const char* what)
+    {
+        cout << "  " << what << ": " << (condition ? "ok" : "FAILED") << endl;
+        return condition;
+    }
+
+    // nowMs 시각에 count개 연속 수신, 통과한 수 반환
+    int AcquireBurst(IngressLimiter& limiter, const IngressLimit& sessionLimit, const IngressLimit* typeLimit, uint32_t packet_id, ULONGLONG nowMs, int count)
+    {
+        int passed = 0;
+        IngressAction action;
+        DWORD waitMs;
+        for (int i = 0; i < count; i++)
+        {
+            if (limiter.TryAcquire(sessionLimit, typeLimit, packet_id, nowMs, action, waitMs))
+            {
+                passed++;
+            }
+        }
+        return passed;
+    }
+}
+
+//------------------------------
+// 충전: 첫 수신에 가득 차고, 이후 경과 시간 x ratePerSec 만큼 충전
+//------------------------------
+bool TestRefill()
+{
+    cout << "=== Ingress Refill Test ===" << endl;
+    bool ok = true;
+
+    const IngressLimit limit{ 10.0, 0.0, IngressAction::DROP };   // 초당 10, 버스트 = 10
+    IngressLimiter limiter;
+
+    ok &= Check(AcquireBurst(limiter, limit, nullptr, MOVE_ID, 1000, 20) == 10, "first burst capped at capacity");
+    ok &= Check(AcquireBurst(limiter, limit, nullptr, MOVE_ID, 1000, 1) == 0, "empty bucket at the same tick");
+    ok &= Check(AcquireBurst(limiter, limit, nullptr, MOVE_ID, 1050, 1) == 0, "half a token after 50ms");
+    ok &= Check(AcquireBurst(limiter, limit, nullptr, MOVE_ID, 1100, 2) == 1, "one token after 100ms");
+    ok &= Check(AcquireBurst(limiter, limit, nullptr, MOVE_ID, 1600, 10) == 5, "five tokens after 500ms");
+
+    // 시계가 되돌아가도 토큰이 늘거나 줄지 않음
+    ok &= Check(AcquireBurst(limiter, limit, nullptr, MOVE_ID, 1500, 1) == 0, "no refill from a backwards clock");
+
+    // 제한 없음
+    const IngressLimit unlimited{};
+    IngressLimiter open;
+    ok &= Check(AcquireBurst(open, unlimited, nullptr, MOVE_ID, 1000, 1000) == 1000, "disabled limit passes everything");
+
+    cout << "Ingress Refill Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+//------------------------------
+// 버스트 상한: 오래 쉬어도 burst 이상 쌓이지 않음
+//------------------------------
+bool TestBurstCap()
+{
+    cout << "=== Ingress Burst Cap Test ===" << endl;
+    bool ok = true;
+
+    const IngressLimit limit{ 100.0, 5.0, IngressAction::DROP };  // 초당 100, 버스트 5
+    ok &= Check(limit.Capacity() == 5.0, "capacity follows burst");
+    ok &= Check(IngressLimit{ 100.0, 0.0 }.Capacity() == 100.0, "capacity defaults to rate");
+
+    IngressLimiter limiter;
+    ok &= Check(AcquireBurst(limiter, limit, nullptr, MOVE_ID, 1000, 100) == 5, "initial burst capped");
+    ok &= Check(AcquireBurst(limiter, limit, nullptr, MOVE_ID, 61000, 100) == 5, "one minute idle still capped at burst");
+    ok &= Check(AcquireBurst(limiter, limit, nullptr, MOVE_ID, 61020, 100) == 2, "steady rate after the burst");
+
+    cout << "Ingress Burst Cap Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+//------------------------------
+// 타입별 제한: 해당 타입만 따로 막고, 다른 타입은 세션 버킷만 적용
+// 세션 버킷에서 막히면 타입 버킷은 소모하지 않음
+//------------------------------
+bool TestPerTypeOverride()
+{
+    cout << "=== Ingress Per-Type Override Test ===" << endl;
+    bool ok = true;
+
+    const IngressLimit sessionLimit{ 10.0, 10.0, IngressAction::DISCONNECT };
+    const IngressLimit moveLimit{ 20.0, 3.0, IngressAction::DEFER };
+    IngressLimiter limiter;
+    IngressAction action = IngressAction::DROP;
+    DWORD waitMs = 0;
+
+    ok &= Check(AcquireBurst(limiter, sessionLimit, &moveLimit, MOVE_ID, 1000, 10) == 3, "type limit stricter than session");
+    ok &= Check(!limiter.TryAcquire(sessionLimit, &moveLimit, MOVE_ID, 1000, action, waitMs) && action == IngressAction::DEFER,
+                "type limit reports its own action");
+    ok &= Check(AcquireBurst(limiter, sessionLimit, nullptr, ATTACK_ID, 1000, 10) == 7, "other types share the rest of the session bucket");
+    ok &= Check(limiter.typeBuckets.size() == 1, "bucket only for the limited type");
+
+    // 50ms 뒤: 타입 버킷은 1개 충전, 세션 버킷은 0.5개 -> 세션에서 실패, 타입 토큰은 남아 있어야 함
+    ok &= Check(!limiter.TryAcquire(sessionLimit, &moveLimit, MOVE_ID, 1050, action, waitMs) && action == IngressAction::DISCONNECT,
+                "session limit still applies to typed packets");
+    ok &= Check(limiter.typeBuckets[MOVE_ID].HasToken(), "type token kept when the session bucket rejects");
+
+    limiter.Reset();
+    ok &= Check(limiter.typeBuckets.empty() && AcquireBurst(limiter, sessionLimit, &moveLimit, MOVE_ID, 5000, 10) == 3, "reset clears both buckets");
+
+    cout << "Ingress Per-Type Override Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+//------------------------------
+// 초과 시: 막은 쪽의 action, 토큰 1개까지 대기 시간, 실패는 토큰을 소모하지 않음
+//------------------------------
+bool TestExceed()
+{
+    cout << "=== Ingress Exceed Test ===" << endl;
+    bool ok = true;
+
+    const IngressLimit limit{ 4.0, 1.0, IngressAction::DEFER };   // 토큰 1개에 250ms
+    IngressLimiter limiter;
+    IngressAction action = IngressAction::DROP;
+    DWORD waitMs = 0;
+
+    ok &= Check(limiter.TryAcquire(limit, nullptr, MOVE_ID, 1000, action, waitMs), "first packet passes");
+    ok &= Check(!limiter.TryAcquire(limit, nullptr, MOVE_ID, 1000, action, waitMs), "second packet exceeds");
+    ok &= Check(action == IngressAction::DEFER, "exceed reports the limit action");
+    ok &= Check(waitMs >= 250 && waitMs <= 251, "wait time until the next token");
+
+    // 실패한 시도는 토큰을 쓰지 않으므로 반복 실패해도 대기 시간이 줄어듦
+    ok &= Check(!limiter.TryAcquire(limit, nullptr, MOVE_ID, 1100, action, waitMs) && waitMs >= 150 && waitMs <= 151, "wait shrinks while deferred");
+    ok &= Check(limiter.TryAcquire(limit, nullptr, MOVE_ID, 1250, action, waitMs), "passes once the wait has elapsed");
+
+    const IngressLimit dropLimit{ 1.0, 1.0, IngressAction::DROP };
+    const IngressLimit disconnectLimit{ 1.0, 1.0, IngressAction::DISCONNECT };
+    IngressLimiter dropLimiter;
+    IngressLimiter disconnectLimiter;
+    AcquireBurst(dropLimiter, dropLimit, nullptr, MOVE_ID, 1000, 1);
+    AcquireBurst(disconnectLimiter, disconnectLimit, nullptr, MOVE_ID, 1000, 1);
+    ok &= Check(!dropLimiter.TryAcquire(dropLimit, nullptr, MOVE_ID, 1000, action, waitMs) && action == IngressAction::DROP, "drop action");
+    ok &= Check(!disconnectLimiter.TryAcquire(disconnectLimit, nullptr, MOVE_ID, 1000, action, waitMs) && action == IngressAction::DISCONNECT, "disconnect action");
+
+    cout << "Ingress Exceed Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+void RunIngressLimitTests()
+{
+    cout << "Starting Ingress Limit Tests..." << endl << endl;
+
+    bool ok = TestRefill();
+    ok = TestBurstCap() && ok;
+    ok = TestPerTypeOverride() && ok;
+    ok = TestExceed() && ok;
+
+    cout << (ok ? "=== All Tests PASSED ===" : "=== Some Tests FAILED ===") << endl;
+}
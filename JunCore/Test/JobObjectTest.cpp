@@ -0,0 +1,376 @@
+﻿#include <iostream>
+#include <array>
+#include <chrono>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../JunCore/core/base.h"    // JunCore 프로젝트의 강제 포함 헤더 (Test 프로젝트에는 없음)
+#include "../JunCore/logic/JobThread.h"
+#include "../JunCore/logic/JobThreadPool.h"
+
+using namespace std;
+
+namespace
+{
+    //------------------------------
+    // 실행된 Job 수만 세는 JobObject (마지막 Job에서 MarkForDelete -> 스레드가 delete)
+    //------------------------------
+    class CountingObject : public JobObject
+    {
+    public:
+        CountingObject(JobThreadBase* thread, atomic<int>& counter) : JobObject(thread), m_counter(counter) {}
+        void Count() { m_counter.fetch_add(1); }
+
+    private:
+        atomic<int>& m_counter;
+    };
+
+    //------------------------------
+    // 여러 스레드가 동시에 PostJob, 작은 Flush 예산으로 처리
+    // 마지막 Job 이후 추가 PostJob 없이 모든 Job이 실행되어야 함 (스케줄 해제 시 Job이 남으면 영원히 대기)
+    //------------------------------
+    bool RunConcurrentPostRounds(JobThreadBase& jobThread, const char* name)
+    {
+        constexpr int ROUNDS = 200;
+        constexpr int PRODUCERS = 4;
+        constexpr int JOBS_PER_PRODUCER = 250;
+        constexpr int TOTAL = PRODUCERS * JOBS_PER_PRODUCER;
+        constexpr auto STRAND_TIMEOUT = chrono::seconds(2);
+
+        int stranded = 0;
+        for (int round = 0; round < ROUNDS; ++round) {
+            atomic<int> counter{0};
+            CountingObject* obj = new CountingObject(&jobThread, counter);
+
+            vector<thread> producers;
+            for (int p = 0; p < PRODUCERS; ++p) {
+                producers.emplace_back([obj]() {
+                    for (int i = 0; i < JOBS_PER_PRODUCER; ++i) {
+                        obj->PostJob([obj]() { obj->Count(); });
+                    }
+                });
+            }
+            for (auto& t : producers) {
+                t.join();
+            }
+
+            const auto deadline = chrono::steady_clock::now() + STRAND_TIMEOUT;
+            while (counter.load() < TOTAL && chrono::steady_clock::now() < deadline) {
+                this_thread::sleep_for(chrono::microseconds(100));
+            }
+            if (counter.load() < TOTAL) {
+                cout << "[" << name << "] round " << round << ": " << (TOTAL - counter.load())
+                     << " job(s) stranded after the last PostJob" << endl;
+                stranded++;
+            }
+
+            // 삭제도 Job으로 (남은 Job이 있었다면 이 PostJob이 다시 스케줄함)
+            obj->PostJob([obj]() { obj->MarkForDelete(); });
+            while (counter.load() < TOTAL) {
+                this_thread::sleep_for(chrono::microseconds(100));
+            }
+        }
+
+        cout << "[" << name << "] " << ROUNDS << " rounds x " << TOTAL << " jobs, stranded rounds: " << stranded
+             << ", budget yields: " << jobThread.GetBudgetExhaustedCount() << endl;
+        return stranded == 0;
+    }
+
+    //------------------------------
+    // 생성/소멸/실행 횟수를 세는 callable (Payload 크기로 인라인 / 외부 블록 저장 선택)
+    //------------------------------
+    struct CallableCounters
+    {
+        int alive = 0;
+        int invoked = 0;
+    };
+
+    template<size_t Payload>
+    struct TrackedCallable
+    {
+        CallableCounters* counters;
+        std::array<char, Payload> payload{};
+
+        explicit TrackedCallable(CallableCounters* c) : counters(c) { counters->alive++; }
+        TrackedCallable(TrackedCallable&& other) noexcept : counters(other.counters), payload(other.payload) { counters->alive++; }
+        TrackedCallable(const TrackedCallable&) = delete;
+        ~TrackedCallable() { counters->alive--; }
+
+        void operator()() { counters->invoked++; }
+    };
+
+    bool Check(bool condition, const char* what)
+    {
+        cout << "  " << what << ": " << (condition ? "ok" : "FAILED") << endl;
+        return condition;
+    }
+
+    //------------------------------
+    // 소멸 횟수를 세는 JobObject (삭제 누수 확인용)
+    //------------------------------
+    class DestructCountingObject : public JobObject
+    {
+    public:
+        DestructCountingObject(JobThreadBase* thread, atomic<int>& destructed) : JobObject(thread), m_destructed(destructed) {}
+        ~DestructCountingObject() override { m_destructed.fetch_add(1); }
+
+    private:
+        atomic<int>& m_destructed;
+    };
+
+    //------------------------------
+    // 자기 자신에게 계속 다시 PostJob하는 Job (keepPosting이 false가 되면 삭제 마킹)
+    //------------------------------
+    struct SelfPostingJob
+    {
+        JobObject* obj;
+        atomic<bool>* keepPosting;
+
+        void operator()() const
+        {
+            if (keepPosting->load())
+            {
+                obj->PostJob(*this);
+            }
+            else
+            {
+                obj->MarkForDelete();
+            }
+        }
+    };
+
+    //------------------------------
+    // 자기 PostJob이 멈추지 않는 JobObject가 있어도 Stop이 시간 상한 안에 끝나는지 확인
+    // 남겨진 JobObject는 재시작한 스레드가 이어서 처리 (누수 없음)
+    //------------------------------
+    bool RunShutdownDrainRound(JobThreadBase& jobThread, const char* name)
+    {
+        constexpr auto STOP_LIMIT = chrono::seconds(5);
+
+        atomic<int> destructed{0};
+        atomic<bool> keepPosting{true};
+
+        jobThread.Start();
+        DestructCountingObject* obj = new DestructCountingObject(&jobThread, destructed);
+        obj->PostJob(SelfPostingJob{obj, &keepPosting});
+        this_thread::sleep_for(chrono::milliseconds(20));
+
+        const auto stopStart = chrono::steady_clock::now();
+        jobThread.Stop();
+        const auto stopElapsed = chrono::steady_clock::now() - stopStart;
+
+        // 재시작해서 남은 JobObject를 마저 처리
+        keepPosting.store(false);
+        jobThread.Start();
+        const auto deadline = chrono::steady_clock::now() + STOP_LIMIT;
+        while (destructed.load() == 0 && chrono::steady_clock::now() < deadline)
+        {
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+        jobThread.Stop();
+
+        cout << "  " << name << ": stop took "
+             << chrono::duration_cast<chrono::milliseconds>(stopElapsed).count() << "ms" << endl;
+        bool ok = Check(stopElapsed < STOP_LIMIT, "stop returns despite a self-posting job");
+        ok &= Check(destructed.load() == 1, "undrained object finished after restart");
+        return ok;
+    }
+}
+
+//------------------------------
+// Flush 예산 + 동시 PostJob 테스트
+//------------------------------
+bool TestFlushBudgetConcurrentPost()
+{
+    cout << "=== Flush Budget Concurrent Post Test ===" << endl;
+
+    JobFlushBudget budget;
+    budget.maxJobs = 2;
+
+    JobThread single;
+    single.SetFlushBudget(budget);
+    single.Start();
+    const bool singleOk = RunConcurrentPostRounds(single, "JobThread");
+    single.Stop();
+
+    JobThreadPool pool(4);
+    pool.SetFlushBudget(budget);
+    pool.Start();
+    const bool poolOk = RunConcurrentPostRounds(pool, "JobThreadPool");
+    pool.Stop();
+
+    const bool ok = singleOk && poolOk;
+    cout << "Flush Budget Concurrent Post Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+//------------------------------
+// Job 소형 버퍼 테스트
+// 인라인 저장 / 외부 블록 저장 / 이동 전용 캡처 / 이동 대입 / 실행 없이 폐기
+//------------------------------
+bool TestJobSmallBuffer()
+{
+    cout << "=== Job Small Buffer Test ===" << endl;
+    bool ok = true;
+
+    // 인라인: INLINE_SIZE 이하 캡처는 Job 안에 저장
+    {
+        int value = 0;
+        const int add = 41;
+        Job job([&value, add]() { value += add + 1; });
+        ok &= Check(job.IsInline(), "small capture stored inline");
+        job();
+        ok &= Check(value == 42, "inline job runs its capture");
+    }
+
+    // 외부 블록: INLINE_SIZE 초과 (풀 등급 / 등급 초과 new 둘 다)
+    {
+        CallableCounters counters;
+        {
+            Job pooled{ TrackedCallable<Job::INLINE_SIZE + 1>(&counters) };
+            Job large{ TrackedCallable<2048>(&counters) };
+            ok &= Check(!pooled.IsInline() && !large.IsInline(), "capture above INLINE_SIZE spills to a block");
+            pooled();
+            large();
+            ok &= Check(counters.invoked == 2, "spilled jobs run");
+        }
+        ok &= Check(counters.alive == 0, "spilled callables destroyed with the job");
+    }
+
+    // 이동 전용 캡처
+    {
+        auto owned = make_unique<int>(7);
+        int seen = 0;
+        Job job([p = std::move(owned), &seen]() { seen = *p; });
+        Job moved(std::move(job));
+        ok &= Check(!job && moved, "move leaves the source empty");
+        moved();
+        ok &= Check(seen == 7, "move-only capture survives the move");
+    }
+
+    // 이동 대입: 대상의 기존 callable은 파괴, 원본 callable은 대상으로
+    {
+        CallableCounters inlineCounters;
+        CallableCounters spillCounters;
+        {
+            Job target{ TrackedCallable<8>(&inlineCounters) };
+            Job source{ TrackedCallable<Job::INLINE_SIZE + 1>(&spillCounters) };
+            target = std::move(source);
+            ok &= Check(inlineCounters.alive == 0, "move-assign destroys the replaced callable");
+            ok &= Check(!source && spillCounters.alive == 1, "move-assign takes the source callable");
+            target();
+            ok &= Check(spillCounters.invoked == 1 && inlineCounters.invoked == 0, "move-assigned job runs the source callable");
+
+            Job inlineSource{ TrackedCallable<8>(&inlineCounters) };
+            target = std::move(inlineSource);
+            ok &= Check(spillCounters.alive == 0 && inlineCounters.alive == 1, "move-assign inline over spilled");
+        }
+        ok &= Check(inlineCounters.alive == 0, "inline callable destroyed at scope end");
+    }
+
+    // 실행 없이 폐기 (삭제 마킹된 JobObject 큐 정리 등)
+    {
+        CallableCounters counters;
+        {
+            Job inlineJob{ TrackedCallable<8>(&counters) };
+            Job spilledJob{ TrackedCallable<Job::INLINE_SIZE + 1>(&counters) };
+            ok &= Check(counters.alive == 2, "callables alive while queued");
+        }
+        ok &= Check(counters.alive == 0 && counters.invoked == 0, "discarded jobs destroy callables without running them");
+
+        Job reset{ TrackedCallable<8>(&counters) };
+        reset = nullptr;
+        ok &= Check(!reset && counters.alive == 0 && counters.invoked == 0, "assigning nullptr discards the callable");
+    }
+
+    cout << "Job Small Buffer Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+//------------------------------
+// 타이머 발사 중 삭제 테스트
+// JobThreadPool은 휠이 워커 0에 있어 만료 Job(TimerFire)의 PostJob이 다른 워커의 삭제 처리와 겹침
+// 삭제 확인을 통과한 TimerFire가 큐를 비운 뒤에 들어와도 누군가 꺼내서 버려야 객체가 해제됨
+//------------------------------
+bool TestDeleteWhileTimerFiring()
+{
+    cout << "=== Delete While Timer Firing Test ===" << endl;
+
+    constexpr int OBJECTS = 20000;
+    constexpr int TIMERS_PER_OBJECT = 4;
+    constexpr auto LEAK_TIMEOUT = chrono::seconds(5);
+
+    JobThreadPool pool(4);
+    pool.Start();
+
+    atomic<int> destructed{0};
+    for (int i = 0; i < OBJECTS; ++i) {
+        DestructCountingObject* obj = new DestructCountingObject(&pool, destructed);
+
+        // 같은 틱에 만료되는 타이머 여러 개 + 같은 틱의 삭제
+        const auto delay = chrono::milliseconds(1 + i % 3);
+        for (int t = 0; t < TIMERS_PER_OBJECT; ++t) {
+            obj->PostJobAfter(delay, []() {});
+        }
+        obj->PostJobAfter(delay, [obj]() { obj->MarkForDelete(); });
+
+        // 휠 만료와 생성이 겹치도록 조금씩 나눠 생성
+        if (i % 500 == 499) {
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+    }
+
+    const auto deadline = chrono::steady_clock::now() + LEAK_TIMEOUT;
+    while (destructed.load() < OBJECTS && chrono::steady_clock::now() < deadline) {
+        this_thread::sleep_for(chrono::milliseconds(1));
+    }
+    const int leaked = OBJECTS - destructed.load();
+    pool.Stop();
+
+    cout << "Objects: " << OBJECTS << ", destructed: " << (OBJECTS - leaked) << ", leaked: " << leaked << endl;
+    const bool ok = leaked == 0;
+    cout << "Delete While Timer Firing Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+//------------------------------
+// 종료 처리 시간 상한 테스트
+// 자기 자신에게 계속 PostJob하는 JobObject가 있으면 종료 처리가 끝나지 않던 문제
+//------------------------------
+bool TestShutdownDrainBounded()
+{
+    cout << "=== Shutdown Drain Bounded Test ===" << endl;
+
+    // 예산이 있어야 운영 루프에서도 양보 (종료 처리는 예산 미설정이어도 시간 상한 적용)
+    JobFlushBudget budget;
+    budget.maxJobs = 8;
+
+    JobThread single;
+    single.SetFlushBudget(budget);
+    const bool singleOk = RunShutdownDrainRound(single, "JobThread");
+
+    JobThreadPool pool(2);
+    pool.SetFlushBudget(budget);
+    const bool poolOk = RunShutdownDrainRound(pool, "JobThreadPool");
+
+    const bool ok = singleOk && poolOk;
+    cout << "Shutdown Drain Bounded Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+//------------------------------
+// 메인 테스트 실행 함수
+//------------------------------
+void RunJobObjectTests()
+{
+    cout << "Starting JobObject Tests..." << endl << endl;
+
+    bool ok = TestJobSmallBuffer();
+    ok = TestFlushBudgetConcurrentPost() && ok;
+    ok = TestDeleteWhileTimerFiring() && ok;
+    ok = TestShutdownDrainBounded() && ok;
+
+    cout << (ok ? "=== All Tests PASSED ===" : "=== Some Tests FAILED ===") << endl;
+}
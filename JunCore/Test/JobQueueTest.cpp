@@ -1,6 +1,8 @@
 ﻿#include <iostream>
 #include <chrono>
 #include <atomic>
+#include <vector>
+#include <stdexcept>
 #include "../JunCommon/queue/JobQueue.h"
 #include "../JunCommon/queue/PacketJob.h"
 
@@ -27,7 +29,7 @@ void TestJobQueue()
     // Job 처리
     Job job;
     while (processedCount.load() < 10) {
-        if (jobQueue.Dequeue(job, 100)) {
+        if (jobQueue.Dequeue(job, chrono::milliseconds(100))) {
             if (job.jobFunction) {
                 job.jobFunction();
             }
@@ -70,6 +72,74 @@ void TestThreadPool()
     cout << "ThreadPool Basic Test: PASSED" << endl << endl;
 }
 
+//------------------------------
+// 우선순위 테스트: 백그라운드 Job이 쌓여 있어도 CRITICAL이 먼저 처리되는지
+// CRITICAL은 바쁜 Worker가 지금 실행 중인 BACKGROUND Job 하나만 기다려야 함
+// -> CRITICAL 대기 p99 <= BACKGROUND 실행 p99 + 여유 (적체된 1000개 뒤에 서면 수백 ms)
+//------------------------------
+void TestPriority()
+{
+    constexpr uint64_t CRITICAL_WAIT_SLACK_US = 20000;  // Worker 깨움/스케줄링 지연 여유
+    constexpr int CRITICAL_JOB_COUNT = 50;
+
+    cout << "=== Priority Test ===" << endl;
+    
+    // 단일 소비자: 제출 순서와 무관하게 우선순위 순으로 꺼내짐
+    JobQueue jobQueue;
+    vector<uint32_t> order;
+    jobQueue.Enqueue(Job([&order]() { order.push_back(JOB_PRIORITY_BACKGROUND); }, JOB_PRIORITY_BACKGROUND));
+    jobQueue.Enqueue(Job([&order]() { order.push_back(JOB_PRIORITY_NORMAL); }, JOB_PRIORITY_NORMAL));
+    jobQueue.Enqueue(Job([&order]() { order.push_back(JOB_PRIORITY_CRITICAL); }, JOB_PRIORITY_CRITICAL));
+    
+    Job job;
+    while (jobQueue.Dequeue(job, chrono::milliseconds(0))) {
+        job.jobFunction();
+    }
+    
+    const bool ordered = order.size() == 3 && order[0] == JOB_PRIORITY_CRITICAL &&
+                         order[1] == JOB_PRIORITY_NORMAL && order[2] == JOB_PRIORITY_BACKGROUND;
+    cout << "Dequeue order: " << (ordered ? "CRITICAL -> NORMAL -> BACKGROUND" : "WRONG") << endl;
+    
+    // 백그라운드 적체 중 CRITICAL 대기 시간
+    bool bounded = false;
+    {
+        ThreadPool pool(2, "PriorityTestPool");
+        for (int i = 0; i < 1000; ++i) {
+            pool.SubmitWithPriority(JOB_PRIORITY_BACKGROUND, []() {
+                this_thread::sleep_for(chrono::microseconds(200));
+            });
+        }
+        atomic<int> criticalDone = 0;
+        for (int i = 0; i < CRITICAL_JOB_COUNT; ++i) {
+            pool.SubmitWithPriority(JOB_PRIORITY_CRITICAL, [&criticalDone]() { criticalDone++; });
+            this_thread::sleep_for(chrono::milliseconds(2));
+        }
+        
+        // 마지막 CRITICAL까지 실행되어 통계에 잡힐 때까지 대기 (BACKGROUND는 아직 적체 중)
+        const auto deadline = chrono::steady_clock::now() + chrono::seconds(1);
+        while (criticalDone.load() < CRITICAL_JOB_COUNT && chrono::steady_clock::now() < deadline) {
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+        this_thread::sleep_for(chrono::milliseconds(10));  // 실행 후 통계 기록까지 여유
+        
+        auto stats = pool.TakePriorityStats();
+        const auto& criticalWait = stats[JOB_PRIORITY_CRITICAL].waitUs;
+        const uint64_t bound = stats[JOB_PRIORITY_BACKGROUND].runUs.ValueAtPercentile(99.0) + CRITICAL_WAIT_SLACK_US;
+        bounded = criticalWait.count == static_cast<uint64_t>(CRITICAL_JOB_COUNT) && criticalWait.ValueAtPercentile(99.0) <= bound;
+        
+        cout << "CRITICAL wait p99: " << criticalWait.ValueAtPercentile(99.0) << " us ("
+             << criticalWait.count << " jobs), bound " << bound << " us" << endl;
+        cout << "BACKGROUND wait p99: " << stats[JOB_PRIORITY_BACKGROUND].waitUs.ValueAtPercentile(99.0) << " us, pending "
+             << pool.GetPendingJobs(JOB_PRIORITY_BACKGROUND) << endl;
+    } // 남은 BACKGROUND Job까지 처리 후 종료
+    
+    const bool passed = ordered && bounded;
+    cout << "Priority Test: " << (passed ? "PASSED" : "FAILED") << endl << endl;
+    if (!passed) {
+        throw runtime_error("Priority Test: CRITICAL jobs were not served ahead of BACKGROUND backlog");
+    }
+}
+
 //------------------------------
 // PacketJob 테스트용 핸들러
 //------------------------------
@@ -195,6 +265,7 @@ void RunJobQueueTests()
     try {
         TestJobQueue();
         TestThreadPool();
+        TestPriority();
         TestPacketJob();
         TestPerformance();
         
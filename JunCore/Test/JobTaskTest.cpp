@@ -0,0 +1,246 @@
+﻿#include <iostream>
+#include <chrono>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include "../JunCore/core/base.h"    // JunCore 프로젝트의 강제 포함 헤더 (Test 프로젝트에는 없음)
+#include "../JunCore/logic/JobThread.h"
+#include "../JunCore/logic/JobTask.h"
+
+using namespace std;
+
+namespace
+{
+    //------------------------------
+    // 소멸된 스레드를 기록하는 JobObject
+    //------------------------------
+    class ThreadRecordingObject : public JobObject
+    {
+    public:
+        explicit ThreadRecordingObject(JobThread* thread) : JobObject(thread) {}
+        ~ThreadRecordingObject() override
+        {
+            destructedOn.store(this_thread::get_id());
+            destructed.store(true);
+        }
+
+        static inline atomic<thread::id> destructedOn{};
+        static inline atomic<bool> destructed{ false };
+    };
+
+    //------------------------------
+    // 코루틴 프레임 파괴 확인용 지역 변수
+    //------------------------------
+    struct FrameGuard
+    {
+        atomic<bool>* destroyed;
+        ~FrameGuard() { destroyed->store(true); }
+    };
+
+    struct CallObservation
+    {
+        thread::id fnThread;
+        thread::id resumedThread;
+        JobObject* resumedIn = nullptr;
+        int result = 0;
+        string error;
+        atomic<bool> done{ false };
+    };
+
+    bool Check(bool condition, const char* what)
+    {
+        cout << "  " << what << ": " << (condition ? "ok" : "FAILED") << endl;
+        return condition;
+    }
+
+    template<typename Pred>
+    bool WaitFor(Pred pred, chrono::milliseconds timeout = chrono::milliseconds(2000))
+    {
+        const auto deadline = chrono::steady_clock::now() + timeout;
+        while (!pred())
+        {
+            if (chrono::steady_clock::now() >= deadline)
+            {
+                return false;
+            }
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    // JobThread의 스레드 id (Job 하나를 돌려서 확인)
+    thread::id GetThreadId(JobObject& obj)
+    {
+        atomic<bool> done{ false };
+        thread::id id;
+        obj.PostJob([&]() { id = this_thread::get_id(); done.store(true); });
+        WaitFor([&]() { return done.load(); });
+        return id;
+    }
+
+    JobTask CallAndRecord(JobObject* target, CallObservation* observation)
+    {
+        observation->result = co_await target->Call([observation]() {
+            observation->fnThread = this_thread::get_id();
+            return 42;
+        });
+        observation->resumedThread = this_thread::get_id();
+        observation->resumedIn = JobObject::GetCurrent();
+        observation->done.store(true);
+    }
+
+    JobTask CallAndCatch(JobObject* target, CallObservation* observation)
+    {
+        try
+        {
+            co_await target->Call([]() -> int { throw runtime_error("call failed"); });
+        }
+        catch (const runtime_error& e)
+        {
+            observation->error = e.what();
+        }
+        observation->resumedThread = this_thread::get_id();
+        observation->resumedIn = JobObject::GetCurrent();
+        observation->done.store(true);
+    }
+
+    JobTask CallIntoDeletedTarget(JobObject* target, atomic<bool>* frameDestroyed, atomic<bool>* resumed)
+    {
+        FrameGuard guard{ frameDestroyed };
+        co_await target->Call([]() {});
+        resumed->store(true);
+    }
+}
+
+//------------------------------
+// Call 왕복: fn은 target 스레드, 재개는 호출자 스레드의 호출자 Job 안
+//------------------------------
+bool TestCallResumesOnCaller()
+{
+    cout << "=== JobTask Call Resume Thread Test ===" << endl;
+    bool ok = true;
+
+    JobThread callerThread;
+    JobThread targetThread;
+    callerThread.Start();
+    targetThread.Start();
+    {
+        JobObject caller(&callerThread);
+        JobObject target(&targetThread);
+        const thread::id callerId = GetThreadId(caller);
+        const thread::id targetId = GetThreadId(target);
+
+        CallObservation observation;
+        caller.PostJob([&]() { CallAndRecord(&target, &observation); });
+        ok &= Check(WaitFor([&]() { return observation.done.load(); }), "coroutine completed");
+        ok &= Check(observation.result == 42, "result carried back");
+        ok &= Check(observation.fnThread == targetId, "fn ran on the target thread");
+        ok &= Check(observation.resumedThread == callerId, "resumed on the caller thread");
+        ok &= Check(observation.resumedIn == &caller, "resumed inside a caller job");
+    }
+    callerThread.Stop();
+    targetThread.Stop();
+
+    cout << "JobTask Call Resume Thread Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+//------------------------------
+// fn이 던진 예외는 호출자 스레드에서 co_await가 다시 던짐
+//------------------------------
+bool TestCallPropagatesException()
+{
+    cout << "=== JobTask Call Exception Test ===" << endl;
+    bool ok = true;
+
+    JobThread callerThread;
+    JobThread targetThread;
+    callerThread.Start();
+    targetThread.Start();
+    {
+        JobObject caller(&callerThread);
+        JobObject target(&targetThread);
+        const thread::id callerId = GetThreadId(caller);
+
+        CallObservation observation;
+        caller.PostJob([&]() { CallAndCatch(&target, &observation); });
+        ok &= Check(WaitFor([&]() { return observation.done.load(); }), "coroutine completed");
+        ok &= Check(observation.error == "call failed", "exception rethrown at co_await");
+        ok &= Check(observation.resumedThread == callerId && observation.resumedIn == &caller, "caught on the caller thread");
+
+        // target은 예외 뒤에도 계속 Job 처리
+        ok &= Check(GetThreadId(target) != thread::id{}, "target keeps processing jobs");
+    }
+    callerThread.Stop();
+    targetThread.Stop();
+
+    cout << "JobTask Call Exception Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+//------------------------------
+// 대기 중 target 삭제: Call Job이 target 스레드에서 버려짐
+// 코루틴은 재개되지 않고 프레임만 파괴, 이미 삭제 마킹된 호출자의 마지막 참조는 호출자 스레드에서 놓여야 함
+//------------------------------
+bool TestTargetDeletedMidAwait()
+{
+    cout << "=== JobTask Target Deleted Mid-Await Test ===" << endl;
+    bool ok = true;
+
+    JobThread callerThread;
+    JobThread targetThread;
+    callerThread.Start();
+    targetThread.Start();
+
+    ThreadRecordingObject::destructed.store(false);
+    auto* caller = new ThreadRecordingObject(&callerThread);
+    auto* target = new JobObject(&targetThread);
+    const thread::id callerId = GetThreadId(*caller);
+
+    // target을 붙잡아 두고 그 뒤에 Call Job을 쌓음
+    atomic<bool> targetBusy{ false };
+    atomic<bool> openGate{ false };
+    target->PostJob([&]() {
+        targetBusy.store(true);
+        while (!openGate.load())
+        {
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+        target->MarkForDelete();
+    });
+    WaitFor([&]() { return targetBusy.load(); });
+
+    atomic<bool> frameDestroyed{ false };
+    atomic<bool> resumed{ false };
+    caller->PostJob([&]() { CallIntoDeletedTarget(target, &frameDestroyed, &resumed); });
+
+    // 호출자 삭제 (대기 중인 Call이 참조를 쥐고 있어 아직 delete되지 않음)
+    caller->PostJob([caller]() { caller->MarkForDelete(); });
+    this_thread::sleep_for(chrono::milliseconds(50));
+    ok &= Check(!ThreadRecordingObject::destructed.load(), "caller kept alive by the pending call");
+
+    // target 삭제 -> Call Job 폐기
+    openGate.store(true);
+    ok &= Check(WaitFor([&]() { return frameDestroyed.load(); }), "coroutine frame destroyed");
+    ok &= Check(WaitFor([&]() { return ThreadRecordingObject::destructed.load(); }), "caller deleted after the call was dropped");
+    ok &= Check(!resumed.load(), "coroutine not resumed");
+    ok &= Check(ThreadRecordingObject::destructedOn.load() == callerId, "caller deleted on its own thread");
+
+    callerThread.Stop();
+    targetThread.Stop();
+
+    cout << "JobTask Target Deleted Mid-Await Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+void RunJobTaskTests()
+{
+    cout << "Starting JobTask Tests..." << endl << endl;
+
+    bool ok = TestCallResumesOnCaller();
+    ok = TestCallPropagatesException() && ok;
+    ok = TestTargetDeletedMidAwait() && ok;
+
+    cout << (ok ? "=== All Tests PASSED ===" : "=== Some Tests FAILED ===") << endl;
+}
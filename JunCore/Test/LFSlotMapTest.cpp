@@ -0,0 +1,168 @@
+﻿#include <iostream>
+#include <chrono>
+#include <atomic>
+#include <thread>
+#include "../JunCore/core/base.h"    // JunCore 프로젝트의 강제 포함 헤더 (Test 프로젝트에는 없음)
+#include "../JunCommon/container/LFSlotMap.h"
+
+using namespace std;
+
+namespace
+{
+    struct SlotValue
+    {
+        int value = 0;
+    };
+
+    bool Check(bool condition, const char* what)
+    {
+        cout << "  " << what << ": " << (condition ? "ok" : "FAILED") << endl;
+        return condition;
+    }
+
+    uint32_t IndexOf(uint64_t handle) { return static_cast<uint32_t>(handle); }
+    uint32_t GenerationOf(uint64_t handle) { return static_cast<uint32_t>(handle >> 32); }
+}
+
+//------------------------------
+// Remove 이후 옛 핸들은 Visit / Publish / Remove 모두 실패
+//------------------------------
+bool TestStaleHandle()
+{
+    cout << "=== LFSlotMap Stale Handle Test ===" << endl;
+    bool ok = true;
+
+    LFSlotMap<SlotValue> map;
+    SlotValue object{ 7 };
+
+    const uint64_t handle = map.Allocate();
+    ok &= Check(handle != 0, "allocate returns a valid handle");
+    ok &= Check(!map.Visit(handle, [](SlotValue*) {}), "visit fails before publish");
+    ok &= Check(map.Publish(handle, &object), "publish");
+
+    int seen = 0;
+    ok &= Check(map.Visit(handle, [&](SlotValue* v) { seen = v->value; }) && seen == 7, "visit sees the published object");
+    ok &= Check(map.GetCount() == 1, "count after allocate");
+
+    ok &= Check(map.Remove(handle), "remove");
+    ok &= Check(map.GetCount() == 0, "count after remove");
+
+    bool called = false;
+    ok &= Check(!map.Visit(handle, [&](SlotValue*) { called = true; }) && !called, "stale visit fails without calling back");
+    ok &= Check(!map.Publish(handle, &object), "stale publish fails");
+    ok &= Check(!map.Remove(handle), "second remove fails");
+    ok &= Check(!map.Visit(0, [](SlotValue*) {}), "null handle fails");
+
+    cout << "LFSlotMap Stale Handle Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+//------------------------------
+// 반납된 인덱스는 세대를 올려 재사용 (옛 핸들과 새 핸들이 구분됨)
+//------------------------------
+bool TestIndexReuse()
+{
+    cout << "=== LFSlotMap Index Reuse Test ===" << endl;
+    bool ok = true;
+
+    LFSlotMap<SlotValue> map;
+    SlotValue first{ 1 };
+    SlotValue second{ 2 };
+
+    const uint64_t oldHandle = map.Allocate();
+    map.Publish(oldHandle, &first);
+    map.Remove(oldHandle);
+
+    const uint64_t newHandle = map.Allocate();
+    ok &= Check(IndexOf(newHandle) == IndexOf(oldHandle), "freed index reused");
+    ok &= Check(GenerationOf(newHandle) == GenerationOf(oldHandle) + 1, "generation bumped on reuse");
+    ok &= Check(map.Publish(newHandle, &second), "publish on the reused slot");
+
+    int seen = 0;
+    ok &= Check(map.Visit(newHandle, [&](SlotValue* v) { seen = v->value; }) && seen == 2, "new handle sees the new object");
+    ok &= Check(!map.Visit(oldHandle, [&](SlotValue* v) { seen = v->value; }) && seen == 2, "old handle does not see the new object");
+    ok &= Check(!map.Remove(oldHandle) && map.Visit(newHandle, [](SlotValue*) {}), "old handle cannot remove the new slot");
+
+    // 여러 번 재사용해도 세대는 계속 증가
+    uint64_t handle = newHandle;
+    bool increasing = true;
+    for (int i = 0; i < 100; i++)
+    {
+        map.Remove(handle);
+        const uint64_t next = map.Allocate();
+        increasing &= IndexOf(next) == IndexOf(handle) && GenerationOf(next) == GenerationOf(handle) + 1;
+        handle = next;
+    }
+    ok &= Check(increasing, "generation increases on every reuse");
+
+    cout << "LFSlotMap Index Reuse Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+//------------------------------
+// Visit이 핀을 쥔 동안 Remove는 반환하지 않음
+// 세대는 먼저 올라가므로 그 사이 새 Visit은 실패하고, 핀이 풀리면 Remove가 끝남
+//------------------------------
+bool TestRemoveWaitsForVisit()
+{
+    cout << "=== LFSlotMap Remove Waits For Visit Test ===" << endl;
+    bool ok = true;
+
+    LFSlotMap<SlotValue> map;
+    SlotValue object{ 3 };
+    const uint64_t handle = map.Allocate();
+    map.Publish(handle, &object);
+
+    atomic<bool> pinned{ false };
+    atomic<bool> releasePin{ false };
+    atomic<bool> removed{ false };
+    atomic<int> seenDuringPin{ 0 };
+
+    thread visitor([&]() {
+        map.Visit(handle, [&](SlotValue* v) {
+            pinned.store(true);
+            while (!releasePin.load())
+            {
+                this_thread::sleep_for(chrono::milliseconds(1));
+            }
+            // Remove가 대기 중이어도 핀을 쥔 동안 객체는 유효
+            seenDuringPin.store(v->value);
+        });
+    });
+
+    while (!pinned.load())
+    {
+        this_thread::yield();
+    }
+
+    thread remover([&]() {
+        map.Remove(handle);
+        removed.store(true);
+    });
+
+    this_thread::sleep_for(chrono::milliseconds(100));
+    ok &= Check(!removed.load(), "remove blocked while visit holds the pin");
+    ok &= Check(!map.Visit(handle, [](SlotValue*) {}), "new visit fails once remove started");
+
+    releasePin.store(true);
+    visitor.join();
+    remover.join();
+
+    ok &= Check(removed.load(), "remove finished after the pin was released");
+    ok &= Check(seenDuringPin.load() == 3, "pinned visit saw the object");
+    ok &= Check(map.GetCount() == 0, "slot freed");
+
+    cout << "LFSlotMap Remove Waits For Visit Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+void RunLFSlotMapTests()
+{
+    cout << "Starting LFSlotMap Tests..." << endl << endl;
+
+    bool ok = TestStaleHandle();
+    ok = TestIndexReuse() && ok;
+    ok = TestRemoveWaitsForVisit() && ok;
+
+    cout << (ok ? "=== All Tests PASSED ===" : "=== Some Tests FAILED ===") << endl;
+}
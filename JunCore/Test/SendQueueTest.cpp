@@ -0,0 +1,253 @@
+﻿#include <iostream>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../JunCore/core/base.h"    // JunCore 프로젝트의 강제 포함 헤더 (Test 프로젝트에는 없음)
+#include "../JunCore/network/SendQueue.h"
+
+using namespace std;
+
+namespace
+{
+    //------------------------------
+    // 테스트용 패킷: [종류 1바이트][대상 id 4바이트][버전 1바이트]
+    //------------------------------
+    enum class Kind : char { APPEAR, DISAPPEAR, MOVE, ATTACK, DAMAGE };
+
+    const char* KindName(Kind kind)
+    {
+        switch (kind) {
+            case Kind::APPEAR:    return "APPEAR";
+            case Kind::DISAPPEAR: return "DISAPPEAR";
+            case Kind::MOVE:      return "MOVE";
+            case Kind::ATTACK:    return "ATTACK";
+            case Kind::DAMAGE:    return "DAMAGE";
+        }
+        return "?";
+    }
+
+    vector<char>* MakePacket(Kind kind, uint32_t subject, char version = 0)
+    {
+        auto* packet = new vector<char>(2 + sizeof(subject));
+        (*packet)[0] = static_cast<char>(kind);
+        memcpy(packet->data() + 1, &subject, sizeof(subject));
+        packet->back() = version;
+        return packet;
+    }
+
+    uint64_t MoveKey(uint32_t subject)
+    {
+        return MakeCoalesceKey(static_cast<uint32_t>(Kind::MOVE), subject);
+    }
+
+    // 종류 -> 레인 (GameServer는 모든 GC 메시지를 NORMAL로 둠)
+    using LaneTable = SendPriority (*)(Kind);
+
+    SendPriority GameServerLanes(Kind)
+    {
+        return SendPriority::NORMAL;
+    }
+
+    // 이전 구성: 전투만 CRITICAL, 입장 목록은 BULK (순서 위반을 검출하는지 확인용)
+    SendPriority SplitLanes(Kind kind)
+    {
+        switch (kind) {
+            case Kind::ATTACK:
+            case Kind::DAMAGE: return SendPriority::CRITICAL;
+            case Kind::APPEAR: return SendPriority::BULK;
+            default:           return SendPriority::NORMAL;
+        }
+    }
+
+    //------------------------------
+    // 수신 측 검증: 대상별로 APPEAR -> (MOVE/ATTACK/DAMAGE)* -> DISAPPEAR 순서여야 함
+    //------------------------------
+    class SubjectOrderChecker
+    {
+    public:
+        void Receive(const vector<char>& packet)
+        {
+            const Kind kind = static_cast<Kind>(packet[0]);
+            uint32_t subject = 0;
+            memcpy(&subject, packet.data() + 1, sizeof(subject));
+            trace_.emplace_back(subject, string(KindName(kind)) + ":" + to_string(static_cast<int>(packet.back())));
+
+            bool& visible = visible_[subject];
+            bool ok = true;
+            switch (kind) {
+                case Kind::APPEAR:    ok = !visible; visible = true; break;
+                case Kind::DISAPPEAR: ok = visible; visible = false; break;
+                default:              ok = visible; break;
+            }
+
+            if (!ok) {
+                if (violations_ == 0) {
+                    cout << "  first violation: " << KindName(kind) << " for subject " << subject
+                         << (visible ? "" : " (not visible)") << endl;
+                }
+                violations_++;
+            }
+        }
+
+        int GetViolations() const { return violations_; }
+
+        // 받은 순서대로 "종류:버전" 나열 (대상 하나만 볼 때)
+        string Trace(uint32_t subject) const
+        {
+            string out;
+            for (const auto& entry : trace_) {
+                if (entry.first == subject) {
+                    out += (out.empty() ? "" : " ") + entry.second;
+                }
+            }
+            return out;
+        }
+
+    private:
+        unordered_map<uint32_t, bool> visible_;
+        vector<pair<uint32_t, string>> trace_;
+        int violations_ = 0;
+    };
+
+    // WSASend 여러 번에 나눠 보내듯 batch 단위로 꺼내 검증
+    int DrainAndCheck(SendQueue& queue, SubjectOrderChecker& checker, int batch)
+    {
+        vector<vector<char>*> sent(batch);
+        int total = 0;
+        while (int count = queue.Gather(sent.data(), batch)) {
+            for (int i = 0; i < count; i++) {
+                checker.Receive(*sent[i]);
+                delete sent[i];
+            }
+            total += count;
+        }
+        return total;
+    }
+
+    //------------------------------
+    // 텔레포트/씬 진입 직후처럼 입장 알림이 몰린 뒤 같은 대상들의 이동/전투/퇴장이 이어지는 상황
+    //------------------------------
+    int RunBurstScenario(LaneTable lanes)
+    {
+        constexpr uint32_t SUBJECTS = 40;
+        const Kind followUps[] = { Kind::MOVE, Kind::ATTACK, Kind::DAMAGE, Kind::DISAPPEAR };
+
+        SendQueue queue;
+        for (uint32_t s = 1; s <= SUBJECTS; ++s) {
+            queue.Enqueue(MakePacket(Kind::APPEAR, s), lanes(Kind::APPEAR));
+        }
+        for (Kind kind : followUps) {
+            for (uint32_t s = 1; s <= SUBJECTS; ++s) {
+                queue.Enqueue(MakePacket(kind, s), lanes(kind));
+            }
+        }
+
+        SubjectOrderChecker checker;
+        DrainAndCheck(queue, checker, 32);
+        return checker.GetViolations();
+    }
+}
+
+//------------------------------
+// 레인 구성별 대상 단위 순서 테스트
+//------------------------------
+bool TestSubjectOrdering()
+{
+    cout << "=== Per-Subject Ordering Test ===" << endl;
+
+    const int gameViolations = RunBurstScenario(GameServerLanes);
+    cout << "GameServer lanes: " << gameViolations << " violation(s) (expected 0)" << endl;
+
+    const int splitViolations = RunBurstScenario(SplitLanes);
+    cout << "Split lanes: " << splitViolations << " violation(s) (expected > 0, checker self-test)" << endl;
+
+    const bool ok = gameViolations == 0 && splitViolations > 0;
+    cout << "Per-Subject Ordering Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+//------------------------------
+// 병합 테스트: 교체는 하되 나중에 보낸 일반 패킷을 추월하지 않아야 함
+//------------------------------
+bool TestCoalesceOrdering()
+{
+    cout << "=== Coalesce Ordering Test ===" << endl;
+
+    const SendPriority lane = SendPriority::NORMAL;
+    bool ok = true;
+
+    // 1. 사이에 일반 패킷이 없으면 제자리에서 교체 (다른 대상의 병합 패킷은 끼어도 됨)
+    {
+        SendQueue queue;
+        queue.Enqueue(MakePacket(Kind::APPEAR, 1), lane);
+        queue.Enqueue(MakePacket(Kind::APPEAR, 2), lane);
+        queue.EnqueueCoalesced(MakePacket(Kind::MOVE, 1, 1), lane, MoveKey(1));
+        queue.EnqueueCoalesced(MakePacket(Kind::MOVE, 2, 1), lane, MoveKey(2));
+        queue.EnqueueCoalesced(MakePacket(Kind::MOVE, 1, 2), lane, MoveKey(1));
+        queue.EnqueueCoalesced(MakePacket(Kind::MOVE, 1, 3), lane, MoveKey(1));
+
+        const int queued = queue.GetCount();
+        SubjectOrderChecker checker;
+        DrainAndCheck(queue, checker, 32);
+
+        const string trace = checker.Trace(1);
+        const bool replaced = queued == 4 && trace == "APPEAR:0 MOVE:3";
+        cout << "Replace in place: queued " << queued << ", subject 1 = [" << trace << "] "
+             << (replaced ? "OK" : "WRONG") << endl;
+        ok = ok && replaced && checker.GetViolations() == 0;
+    }
+
+    // 2. 이동 -> 퇴장 -> 재입장 -> 이동: 새 이동이 퇴장/재입장을 앞지르면 안 됨
+    {
+        SendQueue queue;
+        queue.Enqueue(MakePacket(Kind::APPEAR, 1), lane);
+        queue.EnqueueCoalesced(MakePacket(Kind::MOVE, 1, 1), lane, MoveKey(1));
+        queue.Enqueue(MakePacket(Kind::DISAPPEAR, 1), lane);
+        queue.Enqueue(MakePacket(Kind::APPEAR, 1), lane);
+        queue.EnqueueCoalesced(MakePacket(Kind::MOVE, 1, 2), lane, MoveKey(1));
+        queue.EnqueueCoalesced(MakePacket(Kind::MOVE, 1, 3), lane, MoveKey(1));   // 이건 바로 앞 이동을 교체
+
+        SubjectOrderChecker checker;
+        DrainAndCheck(queue, checker, 32);
+
+        const string trace = checker.Trace(1);
+        const bool ordered = trace == "APPEAR:0 MOVE:1 DISAPPEAR:0 APPEAR:0 MOVE:3";
+        cout << "No overtaking: subject 1 = [" << trace << "] " << (ordered ? "OK" : "WRONG") << endl;
+        ok = ok && ordered && checker.GetViolations() == 0;
+    }
+
+    // 3. 이전 이동이 이미 gather 된 뒤의 이동은 새로 들어감
+    {
+        SendQueue queue;
+        queue.Enqueue(MakePacket(Kind::APPEAR, 1), lane);
+        queue.EnqueueCoalesced(MakePacket(Kind::MOVE, 1, 1), lane, MoveKey(1));
+
+        SubjectOrderChecker checker;
+        DrainAndCheck(queue, checker, 32);
+        queue.EnqueueCoalesced(MakePacket(Kind::MOVE, 1, 2), lane, MoveKey(1));
+        DrainAndCheck(queue, checker, 32);
+
+        const string trace = checker.Trace(1);
+        const bool resent = trace == "APPEAR:0 MOVE:1 MOVE:2";
+        cout << "After gather: subject 1 = [" << trace << "] " << (resent ? "OK" : "WRONG") << endl;
+        ok = ok && resent;
+    }
+
+    cout << "Coalesce Ordering Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+//------------------------------
+// 메인 테스트 실행 함수
+//------------------------------
+void RunSendQueueTests()
+{
+    cout << "Starting SendQueue Tests..." << endl << endl;
+
+    const bool orderingOk = TestSubjectOrdering();
+    const bool coalesceOk = TestCoalesceOrdering();
+    const bool ok = orderingOk && coalesceOk;
+
+    cout << (ok ? "=== All Tests PASSED ===" : "=== Some Tests FAILED ===") << endl;
+}
@@ -0,0 +1,307 @@
+﻿#include <iostream>
+#include <chrono>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "../JunCore/core/base.h"    // JunCore 프로젝트의 강제 포함 헤더 (Test 프로젝트에는 없음)
+#include "../JunCore/logic/JobThread.h"
+#include "../JunCore/logic/TimerWheel.h"
+
+using namespace std;
+using namespace std::chrono;
+
+namespace
+{
+    //------------------------------
+    // 스레드를 띄우지 않고 테스트 스레드가 루프를 직접 돌리는 JobThread
+    // (타이머 발사 / Flush 시점을 테스트가 정함)
+    //------------------------------
+    class ManualJobThread : public JobThread
+    {
+    public:
+        using JobThread::ProcessTimers;
+        using JobThread::ProcessJobObjects;
+        using JobThread::GetParkTimeoutMs;
+
+        size_t GetPendingTimerCount() const { return m_timerWheel.GetCount(); }
+
+        // 타이머 처리 + JobObject 처리 한 바퀴
+        void Pump()
+        {
+            ProcessTimers();
+            while (ProcessJobObjects() > 0)
+            {
+            }
+        }
+
+        // duration 동안 1ms 간격으로 Pump
+        void PumpFor(milliseconds duration)
+        {
+            const auto end = steady_clock::now() + duration;
+            while (steady_clock::now() < end)
+            {
+                Pump();
+                this_thread::sleep_for(milliseconds(1));
+            }
+        }
+    };
+
+    //------------------------------
+    // 소멸 시 카운터를 올리는 JobObject
+    //------------------------------
+    class TimerTestObject : public JobObject
+    {
+    public:
+        TimerTestObject(JobThread* thread, atomic<int>* destructed) : JobObject(thread), m_destructed(destructed) {}
+        ~TimerTestObject() override
+        {
+            if (m_destructed != nullptr)
+            {
+                m_destructed->fetch_add(1);
+            }
+        }
+
+        int fired = 0;
+        TimerId timerId = 0;
+
+    private:
+        atomic<int>* m_destructed;
+    };
+
+    bool Check(bool condition, const char* what)
+    {
+        cout << "  " << what << ": " << (condition ? "ok" : "FAILED") << endl;
+        return condition;
+    }
+}
+
+//------------------------------
+// TimerWheel 발사 순서 테스트 (가상 시각)
+// 같은 슬롯의 다른 바퀴 노드는 자기 바퀴가 올 때까지 남아 있어야 하고,
+// 바퀴를 넘나드는 지연도 만료 시각 순서로 발사되어야 함
+//------------------------------
+bool TestWheelFireOrder()
+{
+    cout << "=== TimerWheel Fire Order Test ===" << endl;
+    bool ok = true;
+
+    const auto lap = TimerWheel::TICK * static_cast<int64_t>(TimerWheel::SLOT_COUNT);
+    const auto base = TimerWheel::Clock::now();
+
+    // 20ms / 20ms + 1바퀴 / 20ms + 2바퀴는 같은 슬롯
+    const vector<milliseconds> delays = {
+        lap * 2 + milliseconds(20),
+        milliseconds(20),
+        milliseconds(700),
+        lap + milliseconds(20),
+        milliseconds(35),
+        lap + milliseconds(300),
+        milliseconds(0),
+    };
+
+    TimerWheel wheel;
+    for (size_t i = 0; i < delays.size(); i++)
+    {
+        TimerNode* node = TimerWheel::AllocNode();
+        node->expireAt = base + delays[i];
+        node->id = i;
+        wheel.Add(node);
+    }
+    ok &= Check(wheel.GetCount() == delays.size(), "all nodes registered");
+
+    // 첫 만료(지연 0 -> 다음 틱)까지 대기 시간은 두 틱 이내
+    const auto firstWait = wheel.GetTimeToNextExpire(base);
+    ok &= Check(firstWait <= TimerWheel::TICK * 2, "next expire is the earliest node");
+
+    // 한 틱씩 시각을 밀며 발사 순서와 시각 확인
+    vector<milliseconds> fired;
+    bool early = false;
+    bool late = false;
+    const auto end = base + lap * 2 + milliseconds(100);
+    for (auto now = base; now <= end; now += TimerWheel::TICK)
+    {
+        wheel.Advance(now, [&](TimerNode* node) {
+            const auto delay = delays[node->id];
+            early |= now < base + delay;
+            late |= now > base + delay + TimerWheel::TICK * 2;
+            fired.push_back(delay);
+            TimerWheel::FreeNode(node);
+        });
+    }
+
+    bool ordered = fired.size() == delays.size();
+    for (size_t i = 1; ordered && i < fired.size(); i++)
+    {
+        ordered = fired[i - 1] <= fired[i];
+    }
+    ok &= Check(ordered, "fired in expire order across laps");
+    ok &= Check(!early, "no node fired before its expire time");
+    ok &= Check(!late, "every node fired within two ticks of expiry");
+    ok &= Check(wheel.IsEmpty(), "wheel empty after the last lap");
+
+    // 오래 멈춘 뒤 한 번에 Advance (한 바퀴만 훑어도 모두 발사)
+    TimerWheel stalledWheel;
+    const auto stallBase = TimerWheel::Clock::now();
+    for (size_t i = 0; i < 3; i++)
+    {
+        TimerNode* node = TimerWheel::AllocNode();
+        node->expireAt = stallBase + lap * static_cast<int64_t>(i) + milliseconds(50);
+        stalledWheel.Add(node);
+    }
+    size_t stallFired = 0;
+    stalledWheel.Advance(stallBase + lap * 4, [&](TimerNode* node) {
+        stallFired++;
+        TimerWheel::FreeNode(node);
+    });
+    ok &= Check(stallFired == 3 && stalledWheel.IsEmpty(), "stalled advance fires every lap at once");
+
+    cout << "TimerWheel Fire Order Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+//------------------------------
+// 반복 타이머 콜백 안에서 자기 자신 취소
+// 취소한 회차 이후로는 실행되지 않고 노드는 바로 반납되어야 함
+//------------------------------
+bool TestCancelInsideCallback()
+{
+    cout << "=== Cancel Inside Callback Test ===" << endl;
+    bool ok = true;
+
+    ManualJobThread thread;
+    TimerTestObject obj(&thread, nullptr);
+
+    obj.PostJob([&obj]() {
+        obj.timerId = obj.PostRepeatingJob(milliseconds(10), [&obj]() {
+            if (++obj.fired == 3)
+            {
+                obj.CancelTimer(obj.timerId);
+            }
+        });
+    });
+    thread.Pump();
+    ok &= Check(obj.timerId != 0, "repeating timer registered");
+
+    // 3회차에서 취소, 이후 여러 간격 동안 더 실행되지 않아야 함
+    const auto deadline = steady_clock::now() + seconds(2);
+    while (obj.fired < 3 && steady_clock::now() < deadline)
+    {
+        thread.PumpFor(milliseconds(5));
+    }
+    thread.PumpFor(milliseconds(100));
+
+    ok &= Check(obj.fired == 3, "no run after cancelling in the callback");
+    ok &= Check(thread.GetPendingTimerCount() == 0, "cancelled node released from the wheel");
+
+    // 취소된 id는 다시 취소되지 않음
+    bool cancelledAgain = true;
+    obj.PostJob([&]() { cancelledAgain = obj.CancelTimer(obj.timerId); });
+    thread.Pump();
+    ok &= Check(!cancelledAgain, "second cancel of the same id fails");
+
+    cout << "Cancel Inside Callback Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+//------------------------------
+// 한 틱보다 짧은 간격 / 지연
+// 1ms 반복은 틱마다 최대 한 번 (한 Advance에서 몰아서 돌지 않음), 지연 0은 다음 틱에 발사
+// Park 대기는 타이머가 있으면 첫 만료까지, 없으면 PARK_TIMEOUT_MS
+//------------------------------
+bool TestSubTickInterval()
+{
+    cout << "=== Sub-Tick Interval Test ===" << endl;
+    bool ok = true;
+
+    ManualJobThread thread;
+    TimerTestObject obj(&thread, nullptr);
+
+    ok &= Check(thread.GetParkTimeoutMs() == 100, "park timeout without timers is PARK_TIMEOUT_MS");
+
+    bool immediateFired = false;
+    obj.PostJobAfter(milliseconds(0), [&]() { immediateFired = true; });
+    thread.Pump();
+    ok &= Check(!immediateFired, "zero delay does not fire in the same pump");
+    const DWORD parkMs = thread.GetParkTimeoutMs();
+    ok &= Check(parkMs >= 1 && parkMs <= static_cast<DWORD>(TimerWheel::TICK.count() * 2), "park timeout bounded by the next tick");
+    thread.PumpFor(TimerWheel::TICK * 3);
+    ok &= Check(immediateFired, "zero delay fires on a later tick");
+
+    obj.PostJob([&obj]() {
+        obj.timerId = obj.PostRepeatingJob(milliseconds(1), [&obj]() { obj.fired++; });
+    });
+    thread.Pump();
+
+    const auto start = steady_clock::now();
+    thread.PumpFor(milliseconds(300));
+    const auto elapsedTicks = duration_cast<milliseconds>(steady_clock::now() - start) / TimerWheel::TICK;
+
+    cout << "  1ms interval over " << elapsedTicks << " ticks fired " << obj.fired << " time(s)" << endl;
+    ok &= Check(obj.fired > 0, "sub-tick interval keeps firing");
+    ok &= Check(obj.fired <= elapsedTicks + 2, "sub-tick interval fires at most once per tick");
+    ok &= Check(thread.GetParkTimeoutMs() <= static_cast<DWORD>(TimerWheel::TICK.count() * 2), "park timeout follows the pending repeat");
+
+    obj.PostJob([&obj]() { obj.CancelTimer(obj.timerId); });
+    thread.PumpFor(TimerWheel::TICK * 3);
+    ok &= Check(thread.GetPendingTimerCount() == 0, "sub-tick timer released after cancel");
+
+    cout << "Sub-Tick Interval Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+//------------------------------
+// 스레드 소멸 시 대기 중인 타이머 반납
+// 삭제 마킹된 JobObject는 남은 타이머가 참조를 쥐고 있어 스레드 소멸 때 delete되어야 하고,
+// 타이머 Job의 캡처도 실행 없이 파괴되어야 함 (휠 / 수신함 양쪽)
+//------------------------------
+bool TestReleaseOnThreadDestroy()
+{
+    cout << "=== Release Pending Timers On Thread Destroy Test ===" << endl;
+    bool ok = true;
+
+    atomic<int> destructed{0};
+    auto token = make_shared<int>(0);
+    int ran = 0;
+
+    auto* thread = new ManualJobThread();
+    auto* obj = new TimerTestObject(thread, &destructed);
+
+    obj->PostJob([obj, token, &ran]() {
+        obj->PostJobAfter(seconds(30), [token, &ran]() { ran++; });
+        obj->PostJobAfter(TimerWheel::TICK * static_cast<int64_t>(TimerWheel::SLOT_COUNT) * 3, [token, &ran]() { ran++; });
+        obj->PostRepeatingJob(seconds(10), [token, &ran]() { ran++; });
+    });
+    thread->Pump();
+    thread->ProcessTimers();
+    ok &= Check(thread->GetPendingTimerCount() == 3, "timers moved into the wheel");
+
+    // 수신함에만 있는 타이머 (휠로 옮기기 전에 소멸)
+    obj->PostJobAfter(seconds(30), [token, &ran]() { ran++; });
+
+    obj->PostJob([obj]() { obj->MarkForDelete(); });
+    while (thread->ProcessJobObjects() > 0)
+    {
+    }
+    ok &= Check(destructed.load() == 0, "marked object kept alive by pending timers");
+
+    delete thread;
+    ok &= Check(destructed.load() == 1, "object deleted when the thread releases its timers");
+    ok &= Check(token.use_count() == 1, "timer captures destroyed");
+    ok &= Check(ran == 0, "released timers did not run");
+
+    cout << "Release Pending Timers On Thread Destroy Test: " << (ok ? "PASSED" : "FAILED") << endl << endl;
+    return ok;
+}
+
+void RunTimerTests()
+{
+    cout << "Starting Timer Tests..." << endl << endl;
+
+    bool ok = TestWheelFireOrder();
+    ok = TestCancelInsideCallback() && ok;
+    ok = TestSubTickInterval() && ok;
+    ok = TestReleaseOnThreadDestroy() && ok;
+
+    cout << (ok ? "=== All Tests PASSED ===" : "=== Some Tests FAILED ===") << endl;
+}
@@ -0,0 +1,162 @@
+#include "../JunCommon/crypto/X25519.h"
+#include "../JunCommon/crypto/RSA2048.h"
+#include "../JunCommon/crypto/AES128.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// X25519 ECDH + HKDF 핸드셰이크 검증 및 RSA 핸드셰이크 대비 벤치마크
+// ============================================================================
+
+namespace
+{
+    constexpr int BENCHMARK_ITERATIONS_RSA = 20;      // RSA 키 생성이 느리므로 적게
+    constexpr int BENCHMARK_ITERATIONS_X25519 = 2000;
+
+    // 로그인 1회 분량의 RSA 핸드셰이크 (HandshakeExample과 동일한 연산 순서)
+    // 클라 RSA 키 생성 -> 서버 RSA 키 생성 -> 서버가 AES 키/IV를 클라 공개키로 암호화 -> 클라 복호화
+    bool RunRSAHandshakeOnce()
+    {
+        RSA2048 client_rsa;
+        RSA2048 server_rsa;
+        if (!client_rsa.GenerateKeyPair() || !server_rsa.GenerateKeyPair()) {
+            return false;
+        }
+
+        RSA2048 server_side_client_key;
+        if (!server_side_client_key.ImportPublicKey(client_rsa.ExportPublicKey())) {
+            return false;
+        }
+
+        auto aes_key = AES128::GenerateRandomKey();
+        auto aes_iv = AES128::GenerateRandomIV();
+
+        std::vector<unsigned char> enc_key, enc_iv;
+        if (!server_side_client_key.EncryptWithPublicKey(aes_key, enc_key) ||
+            !server_side_client_key.EncryptWithPublicKey(aes_iv, enc_iv)) {
+            return false;
+        }
+
+        std::vector<unsigned char> dec_key, dec_iv;
+        if (!client_rsa.DecryptWithPrivateKey(enc_key, dec_key) ||
+            !client_rsa.DecryptWithPrivateKey(enc_iv, dec_iv)) {
+            return false;
+        }
+
+        return dec_key == aes_key && dec_iv == aes_iv;
+    }
+
+    // 로그인 1회 분량의 X25519 핸드셰이크
+    // 양측 임시키 생성 -> 공개키(32바이트) 교환 -> 양측 ECDH + HKDF로 AES 키/IV 유도
+    bool RunX25519HandshakeOnce(std::vector<unsigned char>* out_key = nullptr,
+                                std::vector<unsigned char>* out_iv = nullptr)
+    {
+        X25519 client;
+        X25519 server;
+        if (!client.GenerateKeyPair() || !server.GenerateKeyPair()) {
+            return false;
+        }
+
+        // 서버가 salt(nonce)를 생성해 공개키와 함께 전달한다고 가정
+        auto salt = AES128::GenerateRandomKey();
+
+        if (!server.ImportPeerPublicKey(client.ExportPublicKey()) ||
+            !client.ImportPeerPublicKey(server.ExportPublicKey())) {
+            return false;
+        }
+
+        std::vector<unsigned char> server_key, server_iv;
+        std::vector<unsigned char> client_key, client_iv;
+        if (!server.DeriveAES128SessionKey(salt, server_key, server_iv) ||
+            !client.DeriveAES128SessionKey(salt, client_key, client_iv)) {
+            return false;
+        }
+
+        if (out_key) *out_key = client_key;
+        if (out_iv) *out_iv = client_iv;
+
+        return server_key == client_key && server_iv == client_iv;
+    }
+
+    template<typename Func>
+    double MeasureAverageMicros(int iterations, Func&& func, bool& all_ok)
+    {
+        all_ok = true;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            if (!func()) {
+                all_ok = false;
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+        double total_us = std::chrono::duration<double, std::micro>(end - start).count();
+        return total_us / iterations;
+    }
+}
+
+void TestX25519()
+{
+    std::cout << "\n======= X25519 ECDH + HKDF Handshake Test =======" << std::endl;
+
+    // 1. 키 합의 검증
+    std::vector<unsigned char> key, iv;
+    if (!RunX25519HandshakeOnce(&key, &iv)) {
+        std::cout << "[FAIL] X25519 key agreement mismatch: " << X25519::GetLastError() << std::endl;
+        return;
+    }
+    std::cout << "[OK] Both sides derived identical AES-128 key/IV ("
+              << key.size() << " + " << iv.size() << " bytes)" << std::endl;
+
+    // 2. 유도된 키로 AES 왕복 검증
+    const std::string message = "X25519 derived session key round-trip";
+    std::vector<unsigned char> plaintext(message.begin(), message.end());
+    std::vector<unsigned char> ciphertext, decrypted;
+    if (!AES128::Encrypt(plaintext, key, iv, ciphertext) ||
+        !AES128::Decrypt(ciphertext, key, iv, decrypted) ||
+        decrypted != plaintext) {
+        std::cout << "[FAIL] AES round-trip with derived key" << std::endl;
+        return;
+    }
+    std::cout << "[OK] AES-128 round-trip with derived key" << std::endl;
+
+    // 3. 잘못된 공개키 거부 검증
+    X25519 probe;
+    probe.GenerateKeyPair();
+    if (probe.ImportPeerPublicKey(std::vector<unsigned char>(16, 0x01))) {
+        std::cout << "[FAIL] Short public key was accepted" << std::endl;
+        return;
+    }
+    std::vector<unsigned char> dummy_key, dummy_iv;
+    if (probe.ImportPeerPublicKey(std::vector<unsigned char>(X25519Constants::KEY_SIZE_BYTES, 0x00)) &&
+        probe.DeriveAES128SessionKey({}, dummy_key, dummy_iv)) {
+        std::cout << "[FAIL] Small-order (all-zero) public key produced a session key" << std::endl;
+        return;
+    }
+    std::cout << "[OK] Invalid / small-order public keys rejected" << std::endl;
+
+    // 4. 로그인당 핸드셰이크 CPU 비용 비교
+    std::cout << "\n=== Per-login handshake cost ===" << std::endl;
+
+    bool rsa_ok = false;
+    double rsa_us = MeasureAverageMicros(BENCHMARK_ITERATIONS_RSA, [] { return RunRSAHandshakeOnce(); }, rsa_ok);
+
+    bool x25519_ok = false;
+    double x25519_us = MeasureAverageMicros(BENCHMARK_ITERATIONS_X25519, [] { return RunX25519HandshakeOnce(); }, x25519_ok);
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "RSA-2048 (2x keygen + 2x encrypt + 2x decrypt) : "
+              << rsa_us << " us/login (" << BENCHMARK_ITERATIONS_RSA << " iterations)"
+              << (rsa_ok ? "" : " [ERRORS]") << std::endl;
+    std::cout << "X25519   (2x keygen + 2x ECDH + 2x HKDF)       : "
+              << x25519_us << " us/login (" << BENCHMARK_ITERATIONS_X25519 << " iterations)"
+              << (x25519_ok ? "" : " [ERRORS]") << std::endl;
+    if (x25519_us > 0.0) {
+        std::cout << "Speedup: x" << (rsa_us / x25519_us) << std::endl;
+    }
+    std::cout << std::defaultfloat;
+
+    std::cout << "\n=== X25519 Test Complete ===" << std::endl;
+}
@@ -6,10 +6,17 @@
 // 테스트 함수 선언
 void TestAES();
 void TestRSA();
+void TestX25519();
 void RunHandshakeSimulation();
 int packet_test();
 void RunJobQueueTests();
 void RunOnceInitializerTests();
+void RunJobObjectTests();
+void RunSendQueueTests();
+void RunTimerTests();
+void RunLFSlotMapTests();
+void RunJobTaskTests();
+void RunIngressLimitTests();
 
 void ShowMainMenu()
 {
@@ -25,9 +32,16 @@ void ShowMainMenu()
     std::cout << "  6. JobQueue/ThreadPool Test" << std::endl;
     std::cout << "  7. OnceInitializer Test" << std::endl;
     std::cout << "  8. Run All Tests" << std::endl;
+    std::cout << "  9. X25519 Handshake Benchmark" << std::endl;
+    std::cout << " 10. JobObject Flush Test" << std::endl;
+    std::cout << " 11. SendQueue Ordering Test" << std::endl;
+    std::cout << " 12. Timer Test" << std::endl;
+    std::cout << " 13. LFSlotMap Test" << std::endl;
+    std::cout << " 14. JobTask Coroutine Test" << std::endl;
+    std::cout << " 15. Ingress Limit Test" << std::endl;
     std::cout << "  0. Exit" << std::endl;
     std::cout << "========================================" << std::endl;
-    std::cout << "Enter your choice (0-8): ";
+    std::cout << "Enter your choice (0-15): ";
 }
 
 void ClearInputBuffer()
@@ -125,17 +139,80 @@ int main()
                 std::cout << "\n>>> Starting OnceInitializer Test..." << std::endl;
                 RunOnceInitializerTests();
                 
+                std::cout << "\n>>> Starting X25519 Handshake Benchmark..." << std::endl;
+                TestX25519();
+                
+                std::cout << "\n>>> Starting JobObject Flush Test..." << std::endl;
+                RunJobObjectTests();
+                
+                std::cout << "\n>>> Starting SendQueue Ordering Test..." << std::endl;
+                RunSendQueueTests();
+                
+                std::cout << "\n>>> Starting Timer Test..." << std::endl;
+                RunTimerTests();
+                
+                std::cout << "\n>>> Starting LFSlotMap Test..." << std::endl;
+                RunLFSlotMapTests();
+                
+                std::cout << "\n>>> Starting JobTask Coroutine Test..." << std::endl;
+                RunJobTaskTests();
+                
+                std::cout << "\n>>> Starting Ingress Limit Test..." << std::endl;
+                RunIngressLimitTests();
+                
                 std::cout << "\n=== All Tests Complete ===" << std::endl;
                 PressAnyKeyToContinue();
                 break;
                 
+            case 9:
+                std::cout << "\n[RUNNING] X25519 Handshake Benchmark\n" << std::endl;
+                TestX25519();
+                PressAnyKeyToContinue();
+                break;
+                
+            case 10:
+                std::cout << "\n[RUNNING] JobObject Flush Test\n" << std::endl;
+                RunJobObjectTests();
+                PressAnyKeyToContinue();
+                break;
+                
+            case 11:
+                std::cout << "\n[RUNNING] SendQueue Ordering Test\n" << std::endl;
+                RunSendQueueTests();
+                PressAnyKeyToContinue();
+                break;
+                
+            case 12:
+                std::cout << "\n[RUNNING] Timer Test\n" << std::endl;
+                RunTimerTests();
+                PressAnyKeyToContinue();
+                break;
+                
+            case 13:
+                std::cout << "\n[RUNNING] LFSlotMap Test\n" << std::endl;
+                RunLFSlotMapTests();
+                PressAnyKeyToContinue();
+                break;
+                
+            case 14:
+                std::cout << "\n[RUNNING] JobTask Coroutine Test\n" << std::endl;
+                RunJobTaskTests();
+                PressAnyKeyToContinue();
+                break;
+                
+            case 15:
+                std::cout << "\n[RUNNING] Ingress Limit Test\n" << std::endl;
+                RunIngressLimitTests();
+                PressAnyKeyToContinue();
+                break;
+                
             case 0:
                 std::cout << "\nExiting... Goodbye!" << std::endl;
                 exitProgram = true;
                 break;
                 
             default:
-                std::cout << "\nInvalid choice! Please select 0-8.\n" << std::endl;
+                std::cout << "\nInvalid choice! Please select 0-15.\n" << std::endl;
                 break;
         }
     }